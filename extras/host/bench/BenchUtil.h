@@ -0,0 +1,116 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Suwatchai K. <suwatchai@outlook.com>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef ESP_SSLCLIENT_HOST_BENCH_UTIL_H
+#define ESP_SSLCLIENT_HOST_BENCH_UTIL_H
+
+// Shared helpers for the host benchmarks: cycle counter, percentiles and
+// process heap tracking.
+//
+// The heap tracking replaces malloc/calloc/realloc/free for the whole process
+// (glibc supports this), so this header must be included by exactly one
+// translation unit of each benchmark executable.
+
+#include <Arduino.h>
+#include <malloc.h>
+#include <algorithm>
+#include <vector>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define BENCH_HAS_CYCLES 1
+#else
+#define BENCH_HAS_CYCLES 0
+#endif
+
+// Time stamp counter, 0 where not available.
+static inline uint64_t bench_cycles()
+{
+#if BENCH_HAS_CYCLES
+    return __rdtsc();
+#else
+    return 0;
+#endif
+}
+
+// Nearest-rank percentile (p in 0..100) of the samples; sorts in place.
+static inline double bench_percentile(std::vector<double> &v, double p)
+{
+    if (v.empty())
+        return 0;
+    std::sort(v.begin(), v.end());
+    size_t rank = (size_t)((p / 100.0) * v.size() + 0.999999);
+    if (rank < 1)
+        rank = 1;
+    if (rank > v.size())
+        rank = v.size();
+    return v[rank - 1];
+}
+
+struct bench_heap_stats
+{
+    long current = 0;
+    long peak = 0;
+    size_t allocs = 0;
+};
+
+static bench_heap_stats bench_heap;
+
+// Restarts peak tracking from the current heap usage.
+static inline void bench_heap_reset_peak() { bench_heap.peak = bench_heap.current; }
+
+extern "C"
+{
+    void *__libc_malloc(size_t size);
+    void *__libc_calloc(size_t n, size_t size);
+    void *__libc_realloc(void *ptr, size_t size);
+    void __libc_free(void *ptr);
+
+    static inline void bench_heap_add(void *p)
+    {
+        if (!p)
+            return;
+        bench_heap.current += (long)malloc_usable_size(p);
+        bench_heap.allocs++;
+        if (bench_heap.current > bench_heap.peak)
+            bench_heap.peak = bench_heap.current;
+    }
+
+    void *malloc(size_t size)
+    {
+        void *p = __libc_malloc(size);
+        bench_heap_add(p);
+        return p;
+    }
+
+    void *calloc(size_t n, size_t size)
+    {
+        void *p = __libc_calloc(n, size);
+        bench_heap_add(p);
+        return p;
+    }
+
+    void *realloc(void *ptr, size_t size)
+    {
+        long old = ptr ? (long)malloc_usable_size(ptr) : 0;
+        void *p = __libc_realloc(ptr, size);
+        if (p || !size)
+        {
+            bench_heap.current -= old;
+            bench_heap_add(p);
+        }
+        return p;
+    }
+
+    void free(void *ptr)
+    {
+        if (ptr)
+            bench_heap.current -= (long)malloc_usable_size(ptr);
+        __libc_free(ptr);
+    }
+}
+
+#endif
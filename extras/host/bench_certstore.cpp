@@ -0,0 +1,277 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Suwatchai K. <suwatchai@outlook.com>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+// CertStore lookup benchmark.
+//
+// Builds certificate archives of growing size (copies of the test roots with
+// unique subject names, plus the real EC root), indexes them with
+// CertStore::initCertStore() on the host FS shim (build time, heap
+// allocations, peak heap, and the 4 KB flash blocks written with the time
+// they take at flash_block_ms each, in the cost model of the shim, where
+// overwriting data rewrites its blocks) and reports per lookup the
+// index reads and time of the binary search, next to a linear scan of the
+// same index as the previous CertStore did, for hits and misses. One
+// handshake per archive checks that the store still verifies the server.
+// Then, for the 150 certificate archive, repeated lookups of a few anchors
+// (reconnects to the same servers) with the trust anchor cache off and on.
+//
+// Usage: bench_certstore [lookups]
+
+#include <ESP_SSLClient.h>
+#include "loopback/LoopbackServer.h"
+#include "bench/BenchUtil.h"
+
+#include <string>
+#include <unistd.h>
+
+// Exposes the BearSSL callbacks of the store.
+class BenchCertStore : public CertStore
+{
+public:
+    const br_x509_trust_anchor *find(const uint8_t *hash) { return findHashedTA(this, (void *)hash, 32); }
+
+    void release(const br_x509_trust_anchor *ta) { freeHashedTA(this, ta); }
+};
+
+// Erase and program time of one 4 KB block of SPI NOR flash
+static const double flash_block_ms = 50.0;
+
+struct index_entry
+{
+    uint8_t sha256[32];
+    uint32_t offset;
+    uint32_t length;
+};
+
+// DER of the first certificate of a PEM string.
+static std::vector<uint8_t> pem_to_der(const char *pem)
+{
+    X509List list(pem);
+    const br_x509_certificate *cert = list.getX509Certs();
+    return std::vector<uint8_t>(cert->data, cert->data + cert->data_len);
+}
+
+static void ar_member(FILE *f, int id, const std::vector<uint8_t> &der)
+{
+    char header[61];
+    snprintf(header, sizeof(header), "%-16s%-12s%-6s%-6s%-8s%-10zu`\n", ("ca_" + std::to_string(id) + ".der").c_str(), "0", "0", "0", "644", der.size());
+    fwrite(header, 1, 60, f);
+    fwrite(der.data(), 1, der.size(), f);
+    if (der.size() & 1)
+        fputc('\n', f);
+}
+
+// Writes count certificates: copies of the test roots whose subject
+// "Test" is replaced by a number, then the unmodified EC root.
+static void write_archive(const std::string &path, size_t count)
+{
+    const std::vector<uint8_t> roots[2] = {pem_to_der(host_ec_root_cert), pem_to_der(host_rsa_root_cert)};
+    FILE *f = fopen(path.c_str(), "wb");
+    fwrite("!<arch>\n", 1, 8, f);
+    for (size_t i = 0; i + 1 < count; i++)
+    {
+        std::vector<uint8_t> der = roots[i & 1];
+        // the subject comes after the issuer, patch the last occurrence
+        for (size_t p = der.size() - 4; p > 0; p--)
+        {
+            if (memcmp(&der[p], "Test", 4) == 0)
+            {
+                char num[5];
+                snprintf(num, sizeof(num), "%04zu", i % 10000);
+                memcpy(&der[p], num, 4);
+                break;
+            }
+        }
+        ar_member(f, (int)i, der);
+    }
+    ar_member(f, (int)count, roots[0]);
+    fclose(f);
+}
+
+// The old CertStore lookup: read the index 40 bytes at a time until the hash matches.
+static bool linear_find(FS &fs, const uint8_t *hash)
+{
+    File index = fs.open("/certs.idx", FILE_READ);
+    index_entry e;
+    while (index.read((uint8_t *)&e, sizeof(e)) == sizeof(e))
+    {
+        if (memcmp(e.sha256, hash, 32) == 0)
+            return true;
+    }
+    return false;
+}
+
+static bool run(const std::string &dir, size_t count, int lookups)
+{
+    write_archive(dir + "/certs.ar", count);
+
+    FS fs(dir.c_str());
+    BenchCertStore store;
+    store.setCacheSize(0);
+    const size_t allocs = bench_heap.allocs;
+    bench_heap_reset_peak();
+    const long heap = bench_heap.current;
+    fs.resetStats();
+    unsigned long t0 = micros();
+    int n = store.initCertStore(fs, "/certs.idx", "/certs.ar");
+    const unsigned long t_init = micros() - t0;
+    const size_t init_blocks = fs.stats().blocks_written();
+    const size_t init_allocs = bench_heap.allocs - allocs;
+    const long init_peak = bench_heap.peak - heap;
+    if (n != (int)count)
+    {
+        printf("%zu certs: initCertStore returned %d\n", count, n);
+        return false;
+    }
+
+    std::vector<index_entry> entries(count);
+    File index = fs.open("/certs.idx", FILE_READ);
+    index.read((uint8_t *)entries.data(), count * sizeof(index_entry));
+    index.close();
+    for (size_t i = 1; i < count; i++)
+    {
+        if (memcmp(entries[i - 1].sha256, entries[i].sha256, 32) > 0)
+        {
+            printf("%zu certs: index is not sorted\n", count);
+            return false;
+        }
+    }
+
+    // hits in a fixed pseudo random order, misses with a flipped hash byte
+    double bin_reads[2] = {0}, bin_us[2] = {0}, lin_reads[2] = {0}, lin_us[2] = {0};
+    for (int miss = 0; miss < 2; miss++)
+    {
+        for (int i = 0; i < lookups; i++)
+        {
+            uint8_t hash[32];
+            memcpy(hash, entries[(i * 7919u) % count].sha256, 32);
+            if (miss)
+                hash[31] ^= 0x5a;
+
+            fs.resetStats();
+            t0 = micros();
+            const br_x509_trust_anchor *ta = store.find(hash);
+            bin_us[miss] += micros() - t0;
+            bin_reads[miss] += fs.stats().reads;
+            if ((ta != nullptr) == (miss != 0))
+            {
+                printf("%zu certs: binary search %s\n", count, miss ? "found a missing hash" : "missed");
+                return false;
+            }
+            if (ta)
+                store.release(ta);
+
+            fs.resetStats();
+            t0 = micros();
+            bool found = linear_find(fs, hash);
+            lin_us[miss] += micros() - t0;
+            lin_reads[miss] += fs.stats().reads;
+            if (found == (miss != 0))
+            {
+                printf("%zu certs: linear scan mismatch\n", count);
+                return false;
+            }
+        }
+    }
+
+    // end to end, the server root is the last archive member
+    LoopbackClient basic_client;
+    LoopbackServer server(basic_client, loopback_key_ec);
+    ESP_SSLClient2 ssl_client(basic_client);
+    ssl_client.setCertStore(&store);
+    ssl_client.setX509Time(time(nullptr));
+    if (!ssl_client.connect("localhost", 443))
+    {
+        printf("%zu certs: handshake with the cert store failed\n", count);
+        return false;
+    }
+    ssl_client.stop();
+
+    // Hit lookups include loading and decoding the certificate, which is the
+    // same for both searches, so the scan column only times the index part.
+    printf("%6zu %9.1f %7zu %7.1f %7zu %9.0f | %7.1f %9.1f %7.1f %9.1f | %7.1f %9.1f %7.1f %9.1f\n", count, t_init / 1000.0, init_allocs, init_peak / 1024.0,
+           init_blocks, init_blocks * flash_block_ms,
+           bin_reads[0] / lookups, bin_us[0] / lookups, lin_reads[0] / lookups, lin_us[0] / lookups,
+           bin_reads[1] / lookups, bin_us[1] / lookups, lin_reads[1] / lookups, lin_us[1] / lookups);
+
+    fs.remove("/certs.idx");
+    fs.remove("/certs.ar");
+    return true;
+}
+
+// Lookups cycling over servers distinct anchors, per lookup reads, time and
+// heap allocations with the trust anchor cache off (0) or holding entries.
+static bool run_cache(const std::string &dir, size_t servers, int lookups)
+{
+    const size_t count = 150;
+    write_archive(dir + "/certs.ar", count);
+
+    FS fs(dir.c_str());
+    std::vector<index_entry> entries(count);
+    {
+        BenchCertStore store;
+        store.initCertStore(fs, "/certs.idx", "/certs.ar");
+        File index = fs.open("/certs.idx", FILE_READ);
+        index.read((uint8_t *)entries.data(), count * sizeof(index_entry));
+    }
+
+    const size_t sizes[] = {0, 2, 8};
+    for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++)
+    {
+        BenchCertStore store;
+        store.setCacheSize(sizes[s]);
+        store.initCertStore(fs, "/certs.idx", "/certs.ar");
+
+        fs.resetStats();
+        const size_t allocs = bench_heap.allocs;
+        const unsigned long t0 = micros();
+        for (int i = 0; i < lookups; i++)
+        {
+            const br_x509_trust_anchor *ta = store.find(entries[(i % servers) * 17 % count].sha256);
+            if (!ta)
+            {
+                printf("cache %zu: lookup failed\n", sizes[s]);
+                return false;
+            }
+            store.release(ta);
+        }
+        const unsigned long us = micros() - t0;
+
+        printf("%7zu %6zu | %7.2f %9.1f %7.2f | %6zu %6zu\n", servers, sizes[s], (double)fs.stats().reads / lookups,
+               (double)us / lookups, (double)(bench_heap.allocs - allocs) / lookups, store.cacheHits(), store.cacheMisses());
+    }
+
+    fs.remove("/certs.idx");
+    fs.remove("/certs.ar");
+    return true;
+}
+
+int main(int argc, char **argv)
+{
+    const int lookups = argc > 1 ? atoi(argv[1]) : 200;
+    char tmpl[] = "/tmp/bench_certstore.XXXXXX";
+    if (!mkdtemp(tmpl))
+    {
+        printf("can't create a temporary directory\n");
+        return 1;
+    }
+
+    printf("%6s %43s | %-35s | %-35s\n", "", "", "hit (search + DER load)", "miss");
+    printf("%6s %9s %7s %7s %7s %9s | %7s %9s %7s %9s | %7s %9s %7s %9s\n", "certs", "init ms", "allocs", "peak KB", "blocks", "flash ms", "reads", "bin us", "reads", "scan us", "reads", "bin us", "reads", "scan us");
+
+    bool ok = true;
+    const size_t counts[] = {10, 50, 150, 500, 2000};
+    for (size_t i = 0; i < sizeof(counts) / sizeof(counts[0]); i++)
+        ok = run(tmpl, counts[i], lookups) && ok;
+
+    printf("\n%7s %6s | %7s %9s %7s | %6s %6s\n", "servers", "cache", "reads", "us", "allocs", "hits", "misses");
+    const size_t servers[] = {1, 2, 4};
+    for (size_t i = 0; i < sizeof(servers) / sizeof(servers[0]); i++)
+        ok = run_cache(tmpl, servers[i], lookups) && ok;
+
+    rmdir(tmpl);
+    return ok ? 0 : 1;
+}
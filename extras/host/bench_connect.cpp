@@ -0,0 +1,100 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Suwatchai K. <suwatchai@outlook.com>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+// Connection allocation benchmark.
+//
+// Connects BSSL_SSLClient to the loopback server repeatedly with each
+// validator (X.509 chain or insecure) and buffer setting, and
+// reports per connect()/stop() cycle the heap allocations, peak heap and
+// p50 connect time. Built twice: bench_connect with the default allocation
+// and bench_connect_arena with SSLCLIENT_ARENA, which also reports the arena
+// blocks reserved, high-water mark and heap fallbacks.
+//
+// Usage: bench_connect [iterations]
+
+#include <ESP_SSLClient.h>
+#include "loopback/LoopbackServer.h"
+#include "bench/BenchUtil.h"
+
+static bool run(bool insecure, int rx, int tx, bool resume, int iterations)
+{
+    LoopbackClient basic_client;
+    LoopbackServer server(basic_client, loopback_key_ec);
+    server.enableSessionCache(resume);
+
+    ESP_SSLClient2 ssl_client(basic_client);
+    X509List ta(server.rootCert());
+    if (insecure)
+        ssl_client.setInsecure();
+    else
+        ssl_client.setTrustAnchors(&ta);
+    ssl_client.setX509Time(time(nullptr));
+    ssl_client.setBufferSizes(rx, tx);
+
+    BearSSL_Session session;
+    if (resume)
+        ssl_client.setSession(&session);
+
+    std::vector<double> us;
+    double allocs = 0;
+    long peak = 0;
+
+    // The first round is a warm-up and, when resuming, primes the session.
+    for (int i = 0; i <= iterations; i++)
+    {
+        const size_t a0 = bench_heap.allocs;
+        bench_heap_reset_peak();
+        const long heap = bench_heap.current;
+        const unsigned long t0 = micros();
+        const bool ok = ssl_client.connect("localhost", 443);
+        const unsigned long t = micros() - t0;
+        ssl_client.stop();
+        if (!ok)
+        {
+            printf("%s %d/%d: handshake failed\n", insecure ? "insecure" : "x509", rx, tx);
+            return false;
+        }
+        if (i > 0)
+        {
+            us.push_back(t);
+            allocs += bench_heap.allocs - a0;
+            peak = std::max(peak, bench_heap.peak - heap);
+        }
+    }
+
+    printf("%-9s %5d %5d %-8s | %7.1f %8.1f %8.3f", insecure ? "insecure" : "x509", rx, tx, resume ? "resumed" : "full",
+           allocs / iterations, peak / 1024.0, bench_percentile(us, 50) / 1000.0);
+#if defined(SSLCLIENT_ARENA)
+    const esp_sslclient_arena_stats_t stats = ssl_client.getArenaStats();
+    printf(" | %7zu %8.1f %9zu", stats.blocks, stats.high_water / 1024.0, stats.fallbacks);
+#endif
+    printf("\n");
+    return true;
+}
+
+int main(int argc, char **argv)
+{
+    const int iterations = argc > 1 ? atoi(argv[1]) : 50;
+
+#if defined(SSLCLIENT_ARENA)
+    printf("SSLCLIENT_ARENA\n");
+    printf("%-9s %5s %5s %-8s | %7s %8s %8s | %7s %8s %9s\n", "validator", "rx", "tx", "mode", "allocs", "peak KB", "p50 ms", "blocks", "high KB", "fallbacks");
+#else
+    printf("%-9s %5s %5s %-8s | %7s %8s %8s\n", "validator", "rx", "tx", "mode", "allocs", "peak KB", "p50 ms");
+#endif
+
+    bool ok = true;
+    const int buffers[][2] = {{16384, 512}, {4096, 1024}};
+    for (int insecure = 0; insecure < 2; insecure++)
+    {
+        for (size_t b = 0; b < 2; b++)
+        {
+            ok = run(insecure, buffers[b][0], buffers[b][1], false, iterations) && ok;
+            ok = run(insecure, buffers[b][0], buffers[b][1], true, iterations) && ok;
+        }
+    }
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,145 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Suwatchai K. <suwatchai@outlook.com>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+// Record coalescing benchmark.
+//
+// Counts the network client writes, flushes and estimated TCP segments
+// (1460 byte MSS, each write pushed on its own) and measures the client side
+// throughput for uploads and small request/response exchanges, with the
+// default one write+flush per record, with setRecordCoalescing() and with
+// cork()/uncork() around each batch.
+//
+// Usage: bench_flush
+
+#include <ESP_SSLClient.h>
+#include "loopback/LoopbackServer.h"
+
+struct flush_mode
+{
+    const char *name;
+    size_t coalesce;
+    bool cork;
+};
+
+struct workload
+{
+    const char *name;
+    size_t write_size;
+    size_t total;
+    // Wait for the echoed request after each one of this many bytes, 0 for uploads.
+    size_t request_size;
+};
+
+static const flush_mode modes[] = {
+    {"per record (default)", 0, false},
+    {"coalesce 1460", 1460, false},
+    {"coalesce 4380", 4380, false},
+    {"cork + coalesce 16384", 16384, true}};
+
+static const workload workloads[] = {
+    {"upload, 100 B writes", 100, 64 * 1024, 0},
+    {"upload, 4 KB writes", 4096, 256 * 1024, 0},
+    {"request/response 40 B writes", 40, 50 * 680, 680}};
+
+static bool run(const workload &w, const flush_mode &m, int xmit)
+{
+    LoopbackClient basic_client;
+    LoopbackServer server(basic_client, loopback_key_ec);
+    server.setEcho(w.request_size > 0);
+
+    ESP_SSLClient2 ssl_client(basic_client);
+    X509List ta(server.rootCert());
+    ssl_client.setTrustAnchors(&ta);
+    ssl_client.setX509Time(time(nullptr));
+    ssl_client.setBufferSizes(16384, xmit);
+    ssl_client.setRecordCoalescing(m.coalesce);
+
+    if (!ssl_client.connect("localhost", 443))
+    {
+        printf("%s: handshake failed\n", m.name);
+        return false;
+    }
+
+    std::vector<uint8_t> chunk(w.write_size, 'x');
+    std::vector<uint8_t> reply(4096);
+    const size_t batch = w.request_size > 0 ? w.request_size : w.total;
+
+    basic_client.resetStats();
+    server.resetCounters();
+    const unsigned long t0 = micros();
+
+    for (size_t done = 0; done < w.total; done += batch)
+    {
+        if (m.cork)
+            ssl_client.cork();
+
+        for (size_t sent = 0; sent < batch;)
+        {
+            size_t n = batch - sent < chunk.size() ? batch - sent : chunk.size();
+            if (ssl_client.write(chunk.data(), n) != n)
+            {
+                printf("%s: write failed\n", m.name);
+                return false;
+            }
+            sent += n;
+        }
+
+        if (m.cork)
+            ssl_client.uncork();
+
+        if (w.request_size > 0)
+        {
+            // Wait for the echo, reading hands the pending records out first.
+            size_t got = 0;
+            const unsigned long start = millis();
+            while (got < batch && millis() - start < 5000)
+            {
+                if (ssl_client.available() > 0)
+                    got += ssl_client.read(reply.data(), reply.size());
+            }
+            if (got != batch)
+            {
+                printf("%s: echo incomplete (%zu of %zu bytes)\n", m.name, got, batch);
+                return false;
+            }
+        }
+    }
+
+    // Uploads are record-size multiples, so this only hands out held records.
+    ssl_client.available();
+
+    const unsigned long t = micros() - t0;
+    const unsigned long client_us = t > server.busyMicros() ? t - server.busyMicros() : 1;
+
+    if (w.request_size == 0 && server.receivedBytes() != w.total)
+    {
+        printf("%s: server received %zu of %zu bytes\n", m.name, server.receivedBytes(), w.total);
+        return false;
+    }
+
+    const LoopbackStats &st = basic_client.stats();
+    printf("  %-24s %8zu %8zu %9zu %10.1f\n", m.name, st.write_calls, st.flush_calls, st.segments, w.total / (double)client_us);
+
+    ssl_client.stop();
+    return true;
+}
+
+int main()
+{
+    bool ok = true;
+    const int xmit_sizes[] = {512, 4096};
+    for (size_t x = 0; x < sizeof(xmit_sizes) / sizeof(xmit_sizes[0]); x++)
+    {
+        for (size_t i = 0; i < sizeof(workloads) / sizeof(workloads[0]); i++)
+        {
+            printf("\n%s, %d B output buffer\n", workloads[i].name, xmit_sizes[x]);
+            printf("  %-24s %8s %8s %9s %10s\n", "mode", "writes", "flushes", "segments", "MB/s");
+            for (size_t m = 0; m < sizeof(modes) / sizeof(modes[0]); m++)
+                ok = run(workloads[i], modes[m], xmit_sizes[x]) && ok;
+        }
+    }
+    return ok ? 0 : 1;
+}
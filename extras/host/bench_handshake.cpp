@@ -0,0 +1,306 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Suwatchai K. <suwatchai@outlook.com>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+// Handshake latency benchmark.
+//
+// Connects BSSL_SSLClient to the loopback server repeatedly and reports the
+// p50/p99 wall time, the client share of it (server engine time removed),
+// CPU cycles and the peak heap used by the connect() call for:
+//
+//   - RSA-2048 key exchange vs. ECDHE over P-256 vs. ECDHE over X25519,
+//   - every suite of suites_P and faster_suites_P,
+//
+// each as a full handshake and as a resumed one (BearSSL_Session), and full
+// handshakes with chain validation vs. public key and certificate pins.
+//
+// Usage: bench_handshake [iterations]
+
+#include <ESP_SSLClient.h>
+#include "loopback/LoopbackServer.h"
+#include "bench/BenchUtil.h"
+
+struct suite_name
+{
+    uint16_t id;
+    const char *name;
+};
+
+#define BENCH_SUITE(s) {BR_TLS_##s, #s}
+
+static const suite_name suite_names[] = {
+    BENCH_SUITE(ECDHE_ECDSA_WITH_CHACHA20_POLY1305_SHA256),
+    BENCH_SUITE(ECDHE_RSA_WITH_CHACHA20_POLY1305_SHA256),
+    BENCH_SUITE(ECDHE_ECDSA_WITH_AES_128_GCM_SHA256),
+    BENCH_SUITE(ECDHE_RSA_WITH_AES_128_GCM_SHA256),
+    BENCH_SUITE(ECDHE_ECDSA_WITH_AES_256_GCM_SHA384),
+    BENCH_SUITE(ECDHE_RSA_WITH_AES_256_GCM_SHA384),
+    BENCH_SUITE(ECDHE_ECDSA_WITH_AES_128_CCM),
+    BENCH_SUITE(ECDHE_ECDSA_WITH_AES_256_CCM),
+    BENCH_SUITE(ECDHE_ECDSA_WITH_AES_128_CCM_8),
+    BENCH_SUITE(ECDHE_ECDSA_WITH_AES_256_CCM_8),
+    BENCH_SUITE(ECDHE_ECDSA_WITH_AES_128_CBC_SHA256),
+    BENCH_SUITE(ECDHE_RSA_WITH_AES_128_CBC_SHA256),
+    BENCH_SUITE(ECDHE_ECDSA_WITH_AES_256_CBC_SHA384),
+    BENCH_SUITE(ECDHE_RSA_WITH_AES_256_CBC_SHA384),
+    BENCH_SUITE(ECDHE_ECDSA_WITH_AES_128_CBC_SHA),
+    BENCH_SUITE(ECDHE_RSA_WITH_AES_128_CBC_SHA),
+    BENCH_SUITE(ECDHE_ECDSA_WITH_AES_256_CBC_SHA),
+    BENCH_SUITE(ECDHE_RSA_WITH_AES_256_CBC_SHA),
+    BENCH_SUITE(ECDH_ECDSA_WITH_AES_128_GCM_SHA256),
+    BENCH_SUITE(ECDH_RSA_WITH_AES_128_GCM_SHA256),
+    BENCH_SUITE(ECDH_ECDSA_WITH_AES_256_GCM_SHA384),
+    BENCH_SUITE(ECDH_RSA_WITH_AES_256_GCM_SHA384),
+    BENCH_SUITE(ECDH_ECDSA_WITH_AES_128_CBC_SHA256),
+    BENCH_SUITE(ECDH_RSA_WITH_AES_128_CBC_SHA256),
+    BENCH_SUITE(ECDH_ECDSA_WITH_AES_256_CBC_SHA384),
+    BENCH_SUITE(ECDH_RSA_WITH_AES_256_CBC_SHA384),
+    BENCH_SUITE(ECDH_ECDSA_WITH_AES_128_CBC_SHA),
+    BENCH_SUITE(ECDH_RSA_WITH_AES_128_CBC_SHA),
+    BENCH_SUITE(ECDH_ECDSA_WITH_AES_256_CBC_SHA),
+    BENCH_SUITE(ECDH_RSA_WITH_AES_256_CBC_SHA),
+    BENCH_SUITE(RSA_WITH_AES_128_GCM_SHA256),
+    BENCH_SUITE(RSA_WITH_AES_256_GCM_SHA384),
+    BENCH_SUITE(RSA_WITH_AES_128_CCM),
+    BENCH_SUITE(RSA_WITH_AES_256_CCM),
+    BENCH_SUITE(RSA_WITH_AES_128_CCM_8),
+    BENCH_SUITE(RSA_WITH_AES_256_CCM_8),
+    BENCH_SUITE(RSA_WITH_AES_128_CBC_SHA256),
+    BENCH_SUITE(RSA_WITH_AES_256_CBC_SHA256),
+    BENCH_SUITE(RSA_WITH_AES_128_CBC_SHA),
+    BENCH_SUITE(RSA_WITH_AES_256_CBC_SHA),
+    BENCH_SUITE(ECDHE_ECDSA_WITH_3DES_EDE_CBC_SHA),
+    BENCH_SUITE(ECDHE_RSA_WITH_3DES_EDE_CBC_SHA),
+    BENCH_SUITE(ECDH_ECDSA_WITH_3DES_EDE_CBC_SHA),
+    BENCH_SUITE(ECDH_RSA_WITH_3DES_EDE_CBC_SHA),
+    BENCH_SUITE(RSA_WITH_3DES_EDE_CBC_SHA)};
+
+static const char *bench_suite_name(uint16_t id)
+{
+    for (size_t i = 0; i < sizeof(suite_names) / sizeof(suite_names[0]); i++)
+    {
+        if (suite_names[i].id == id)
+            return suite_names[i].name;
+    }
+    return "unknown";
+}
+
+// How the client authenticates the server.
+enum hs_auth
+{
+    auth_chain,
+    auth_spki_pins,
+    auth_cert_pins
+};
+
+// One benchmark row: which suite the client offers and how the server is set up.
+struct hs_config
+{
+    const char *label;
+    uint16_t suite;
+    loopback_server_key key;
+    unsigned issuer_key_type;
+    uint32_t curves;
+    bool resume;
+    hs_auth auth;
+};
+
+static int iterations = 20;
+
+// Picks the server credentials a suite needs: ECDSA and ECDH suites want the
+// EC certificate (ECDH_RSA with an RSA issuer), the others the RSA one.
+static hs_config suite_config(uint16_t suite, bool resume)
+{
+    hs_config cfg;
+    const char *name = bench_suite_name(suite);
+    cfg.label = name;
+    cfg.suite = suite;
+    cfg.curves = 0;
+    cfg.resume = resume;
+    cfg.auth = auth_chain;
+    cfg.issuer_key_type = BR_KEYTYPE_EC;
+    cfg.key = loopback_key_rsa;
+    if (strstr(name, "ECDSA"))
+        cfg.key = loopback_key_ec;
+    else if (strncmp(name, "ECDH_RSA", 8) == 0)
+    {
+        cfg.key = loopback_key_ec;
+        cfg.issuer_key_type = BR_KEYTYPE_RSA;
+    }
+    return cfg;
+}
+
+static bool run(const hs_config &cfg)
+{
+    LoopbackClient basic_client;
+    LoopbackServer server(basic_client, cfg.key);
+    server.setIssuerKeyType(cfg.issuer_key_type);
+    server.setCurves(cfg.curves);
+    server.enableSessionCache(cfg.resume);
+
+    ESP_SSLClient2 ssl_client(basic_client);
+    X509List ta(server.rootCert());
+    uint8_t pins[4][32] = {};
+    if (cfg.auth == auth_chain)
+        ssl_client.setTrustAnchors(&ta);
+    else
+    {
+        // The server's pin last, as with a few known backends
+        memcpy(pins[3], cfg.auth == auth_spki_pins ? server.leafSpkiPin() : server.leafCertPin(), 32);
+        if (cfg.auth == auth_spki_pins)
+            ssl_client.setPublicKeyPins(pins, 4);
+        else
+            ssl_client.setCertificatePins(pins, 4);
+    }
+    ssl_client.setX509Time(time(nullptr));
+    ssl_client.setCiphers(&cfg.suite, 1);
+
+    BearSSL_Session session;
+    if (cfg.resume)
+        ssl_client.setSession(&session);
+
+    std::vector<double> wall_us, client_us, cycles;
+    long peak_heap = 0;
+    int resumed = 0;
+
+    // The first round is a warm-up and, when resuming, primes the session.
+    for (int i = 0; i <= iterations; i++)
+    {
+        server.resetCounters();
+        bench_heap_reset_peak();
+        const long heap_base = bench_heap.current;
+
+        const uint64_t c0 = bench_cycles();
+        const unsigned long t0 = micros();
+        const bool ok = ssl_client.connect("localhost", 443) && server.cipherSuite() == cfg.suite;
+        const unsigned long t = micros() - t0;
+        const uint64_t c = bench_cycles() - c0;
+
+        if (!ok)
+        {
+            printf("%-42s %-8s handshake failed\n", cfg.label, cfg.resume ? "resumed" : "full");
+            return false;
+        }
+
+        if (i > 0)
+        {
+            wall_us.push_back(t);
+            client_us.push_back(t > server.busyMicros() ? t - server.busyMicros() : 0);
+            cycles.push_back((double)c);
+            if (bench_heap.peak - heap_base > peak_heap)
+                peak_heap = bench_heap.peak - heap_base;
+            resumed += server.resumed();
+        }
+        ssl_client.stop();
+    }
+
+    if (cfg.resume && resumed != iterations)
+        printf("%-42s resumed only %d of %d handshakes\n", cfg.label, resumed, iterations);
+
+    printf("%-42s %-8s %8.2f %8.2f %8.2f %8.2f ", cfg.label, cfg.resume ? "resumed" : "full",
+           bench_percentile(wall_us, 50) / 1000.0, bench_percentile(wall_us, 99) / 1000.0,
+           bench_percentile(client_us, 50) / 1000.0, bench_percentile(client_us, 99) / 1000.0);
+    if (BENCH_HAS_CYCLES)
+        printf("%8.2f ", bench_percentile(cycles, 50) / 1e6);
+    else
+        printf("%8s ", "-");
+    printf("%8.1f\n", peak_heap / 1024.0);
+    return true;
+}
+
+static void header(const char *title)
+{
+    printf("\n%s\n", title);
+    printf("%-42s %-8s %8s %8s %8s %8s %8s %8s\n", "", "", "wall", "wall", "client", "client", "Mcycles", "heap");
+    printf("%-42s %-8s %8s %8s %8s %8s %8s %8s\n", "suite", "mode", "p50 ms", "p99 ms", "p50 ms", "p99 ms", "p50", "peak KB");
+}
+
+static bool run_list(const char *title, const uint16_t *suites, size_t count)
+{
+    bool ok = true;
+    header(title);
+    for (size_t i = 0; i < count; i++)
+    {
+        ok = run(suite_config(suites[i], false)) && ok;
+        ok = run(suite_config(suites[i], true)) && ok;
+    }
+    return ok;
+}
+
+static bool run_key_exchange()
+{
+    struct kx
+    {
+        const char *label;
+        uint16_t suite;
+        uint32_t curves;
+    };
+
+    // Same bulk cipher everywhere so only the key exchange differs.
+    const kx list[] = {
+        {"RSA-2048 (RSA_WITH_AES_128_GCM)", BR_TLS_RSA_WITH_AES_128_GCM_SHA256, 0},
+        {"ECDHE_RSA P-256", BR_TLS_ECDHE_RSA_WITH_AES_128_GCM_SHA256, 1u << BR_EC_secp256r1},
+        {"ECDHE_RSA X25519", BR_TLS_ECDHE_RSA_WITH_AES_128_GCM_SHA256, 1u << BR_EC_curve25519},
+        {"ECDHE_ECDSA P-256", BR_TLS_ECDHE_ECDSA_WITH_AES_128_GCM_SHA256, 1u << BR_EC_secp256r1},
+        {"ECDHE_ECDSA X25519", BR_TLS_ECDHE_ECDSA_WITH_AES_128_GCM_SHA256, 1u << BR_EC_curve25519}};
+
+    bool ok = true;
+    header("Key exchange (AES-128-GCM)");
+    for (size_t i = 0; i < sizeof(list) / sizeof(list[0]); i++)
+    {
+        for (int r = 0; r < 2; r++)
+        {
+            hs_config cfg = suite_config(list[i].suite, r == 1);
+            cfg.label = list[i].label;
+            cfg.curves = list[i].curves;
+            ok = run(cfg) && ok;
+        }
+    }
+    return ok;
+}
+
+static bool run_auth()
+{
+    struct auth
+    {
+        const char *label;
+        uint16_t suite;
+        hs_auth auth;
+    };
+
+    const auth list[] = {
+        {"ECDHE_ECDSA P-256, chain", BR_TLS_ECDHE_ECDSA_WITH_AES_128_GCM_SHA256, auth_chain},
+        {"ECDHE_ECDSA P-256, public key pins", BR_TLS_ECDHE_ECDSA_WITH_AES_128_GCM_SHA256, auth_spki_pins},
+        {"ECDHE_ECDSA P-256, certificate pins", BR_TLS_ECDHE_ECDSA_WITH_AES_128_GCM_SHA256, auth_cert_pins},
+        {"ECDHE_RSA P-256, chain", BR_TLS_ECDHE_RSA_WITH_AES_128_GCM_SHA256, auth_chain},
+        {"ECDHE_RSA P-256, public key pins", BR_TLS_ECDHE_RSA_WITH_AES_128_GCM_SHA256, auth_spki_pins},
+        {"ECDHE_RSA P-256, certificate pins", BR_TLS_ECDHE_RSA_WITH_AES_128_GCM_SHA256, auth_cert_pins}};
+
+    bool ok = true;
+    header("Server authentication (4 pins)");
+    for (size_t i = 0; i < sizeof(list) / sizeof(list[0]); i++)
+    {
+        hs_config cfg = suite_config(list[i].suite, false);
+        cfg.label = list[i].label;
+        cfg.curves = 1u << BR_EC_secp256r1;
+        cfg.auth = list[i].auth;
+        ok = run(cfg) && ok;
+    }
+    return ok;
+}
+
+int main(int argc, char **argv)
+{
+    if (argc > 1)
+        iterations = atoi(argv[1]) > 0 ? atoi(argv[1]) : iterations;
+
+    printf("%d handshakes per row, client share excludes the loopback server engine time\n", iterations);
+
+    bool ok = run_key_exchange();
+    ok = run_auth() && ok;
+    ok = run_list("suites_P", suites_P, sizeof(suites_P) / sizeof(suites_P[0])) && ok;
+    ok = run_list("faster_suites_P", faster_suites_P, sizeof(faster_suites_P) / sizeof(faster_suites_P[0])) && ok;
+    return ok ? 0 : 1;
+}
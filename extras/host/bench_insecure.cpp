@@ -0,0 +1,243 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Suwatchai K. <suwatchai@outlook.com>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+// Insecure validator benchmark.
+//
+// Runs the insecure X.509 validator (setInsecure(), setFingerprint(),
+// allowSelfSignedCerts()) over a chain of about 4 KB, next to a copy of the
+// previous validator that always hashed the leaf with SHA-1 and both DNs with
+// SHA-256, and reports the context size and the time per chain. Then connects
+// to the loopback server sending the same chain with each policy and reports
+// the handshake time and the validator bytes held during the handshake.
+//
+// Usage: bench_insecure [iterations]
+
+#include <ESP_SSLClient.h>
+#include "loopback/LoopbackServer.h"
+#include "bench/BenchUtil.h"
+
+using namespace bssl;
+
+// The previous validator: every hash, whatever the policy.
+struct legacy_insecure_context
+{
+    const br_x509_class *vtable;
+    bool done_cert;
+    const uint8_t *match_fingerprint;
+    br_sha1_context sha1_cert;
+    bool allow_self_signed;
+    br_sha256_context sha256_subject;
+    br_sha256_context sha256_issuer;
+    br_x509_decoder_context ctx;
+};
+
+static void legacy_subject_dn_append(void *ctx, const void *buf, size_t len)
+{
+    br_sha256_update(&reinterpret_cast<legacy_insecure_context *>(ctx)->sha256_subject, buf, len);
+}
+
+static void legacy_start_chain(const br_x509_class **ctx, const char *)
+{
+    legacy_insecure_context *xc = reinterpret_cast<legacy_insecure_context *>(ctx);
+    br_x509_decoder_init(&xc->ctx, legacy_subject_dn_append, xc);
+    xc->done_cert = false;
+    br_sha1_init(&xc->sha1_cert);
+    br_sha256_init(&xc->sha256_subject);
+    br_sha256_init(&xc->sha256_issuer);
+}
+
+static void legacy_append(const br_x509_class **ctx, const unsigned char *buf, size_t len)
+{
+    legacy_insecure_context *xc = reinterpret_cast<legacy_insecure_context *>(ctx);
+    if (!xc->done_cert)
+    {
+        br_sha1_update(&xc->sha1_cert, buf, len);
+        br_x509_decoder_push(&xc->ctx, buf, len);
+    }
+}
+
+static void legacy_end_cert(const br_x509_class **ctx) { reinterpret_cast<legacy_insecure_context *>(ctx)->done_cert = true; }
+
+static unsigned legacy_end_chain(const br_x509_class **ctx)
+{
+    const legacy_insecure_context *xc = reinterpret_cast<const legacy_insecure_context *>(ctx);
+    if (!xc->done_cert)
+        return 1;
+    char res[20];
+    br_sha1_out(&xc->sha1_cert, res);
+    if (xc->match_fingerprint && memcmp(res, xc->match_fingerprint, sizeof(res)))
+        return BR_ERR_X509_NOT_TRUSTED;
+    char res_issuer[32];
+    char res_subject[32];
+    br_sha256_out(&xc->sha256_issuer, res_issuer);
+    br_sha256_out(&xc->sha256_subject, res_subject);
+    if (xc->allow_self_signed && memcmp(res_subject, res_issuer, sizeof(res_issuer)))
+        return BR_ERR_X509_NOT_TRUSTED;
+    return 0;
+}
+
+static const br_x509_pkey *legacy_get_pkey(const br_x509_class *const *ctx, unsigned *usages)
+{
+    if (usages)
+        *usages = BR_KEYTYPE_KEYX | BR_KEYTYPE_SIGN;
+    return &reinterpret_cast<const legacy_insecure_context *>(ctx)->ctx.pkey;
+}
+
+static const br_x509_class legacy_vtable = {sizeof(legacy_insecure_context), legacy_start_chain, insecure_start_cert, legacy_append,
+                                             legacy_end_cert, legacy_end_chain, legacy_get_pkey};
+
+static const br_x509_class current_vtable = {sizeof(br_x509_insecure_storage), insecure_start_chain, insecure_start_cert, insecure_append,
+                                              insecure_end_cert, insecure_end_chain, insecure_get_pkey};
+
+enum policy
+{
+    policy_insecure,
+    policy_fingerprint,
+    policy_self_signed
+};
+
+static const char *policy_names[] = {"insecure", "fingerprint", "self-signed"};
+
+// Pushes the chain through the validator the way the SSL engine does, in
+// 512 byte chunks, and returns the end_chain() result.
+static unsigned validate(const br_x509_class **vt, const X509List &chain)
+{
+    (*vt)->start_chain(vt, "localhost");
+    for (size_t i = 0; i < chain.getCount(); i++)
+    {
+        const br_x509_certificate &c = chain.getX509Certs()[i];
+        (*vt)->start_cert(vt, c.data_len);
+        for (size_t off = 0; off < c.data_len; off += 512)
+            (*vt)->append(vt, c.data + off, c.data_len - off < 512 ? c.data_len - off : 512);
+        (*vt)->end_cert(vt);
+    }
+    return (*vt)->end_chain(vt);
+}
+
+// Mean time per chain in microseconds, a chain takes only a few.
+static double time_chain(const br_x509_class **vt, const X509List &chain, int iterations, unsigned &result)
+{
+    result = validate(vt, chain); // warm-up
+    const unsigned long t0 = micros();
+    for (int i = 0; i < iterations; i++)
+        result = validate(vt, chain);
+    return (micros() - t0) / (double)iterations;
+}
+
+static size_t chain_bytes(const X509List &chain)
+{
+    size_t bytes = 0;
+    for (size_t i = 0; i < chain.getCount(); i++)
+        bytes += chain.getX509Certs()[i].data_len;
+    return bytes;
+}
+
+static void add_chain(LoopbackServer *server, X509List &chain, size_t &bytes)
+{
+    // The server chain, then the test certificates again up to about 4 KB
+    const char *extra[] = {host_ec_root_cert, host_rsa_root_cert, host_ec_leaf_cert};
+    chain.append(host_rsa_leaf_cert);
+    chain.append(host_rsa_root_cert);
+    for (size_t i = 0; chain_bytes(chain) < 4096; i = (i + 1) % 3)
+    {
+        chain.append(extra[i]);
+        if (server)
+            server->appendChain(extra[i]);
+    }
+    bytes = chain_bytes(chain);
+}
+
+int main(int argc, char **argv)
+{
+    const int iterations = argc > 1 ? atoi(argv[1]) : 2000;
+
+    X509List chain;
+    size_t chain_len = 0;
+    add_chain(nullptr, chain, chain_len);
+
+    uint8_t fingerprint[20];
+    br_sha1_context sha1;
+    br_sha1_init(&sha1);
+    br_sha1_update(&sha1, chain.getX509Certs()[0].data, chain.getX509Certs()[0].data_len);
+    br_sha1_out(&sha1, fingerprint);
+
+    printf("chain: %zu certificates, %zu bytes, leaf %zu bytes\n\n", chain.getCount(), chain_len, chain.getX509Certs()[0].data_len);
+    printf("%-12s | %-21s | %-21s\n", "", "previous validator", "validator");
+    printf("%-12s | %8s %12s | %8s %12s\n", "policy", "bytes", "us/chain", "bytes", "us/chain");
+
+    bool ok = true;
+    for (int p = policy_insecure; p <= policy_self_signed; p++)
+    {
+        const bool fp = p == policy_fingerprint;
+        const bool ss = p == policy_self_signed;
+
+        legacy_insecure_context legacy;
+        memset(&legacy, 0, sizeof(legacy));
+        legacy.vtable = &legacy_vtable;
+        legacy.match_fingerprint = fp ? fingerprint : nullptr;
+        legacy.allow_self_signed = ss;
+
+        const size_t len = insecure_context_layout(nullptr, fp, ss);
+        br_x509_insecure_context *xc = static_cast<br_x509_insecure_context *>(malloc(len));
+        memset(xc, 0, sizeof(*xc));
+        xc->vtable = &current_vtable;
+        xc->match_fingerprint = fp ? fingerprint : nullptr;
+        xc->allow_self_signed = ss;
+        insecure_context_layout(xc, fp, ss);
+
+        unsigned legacy_result = 0, result = 0;
+        const double legacy_us = time_chain(&legacy.vtable, chain, iterations, legacy_result);
+        const double us = time_chain(&xc->vtable, chain, iterations, result);
+        free(xc);
+
+        printf("%-12s | %8zu %12.2f | %8zu %12.2f\n", policy_names[p], sizeof(legacy), legacy_us, len, us);
+        if (result != legacy_result)
+        {
+            printf("%s: result %u, previous validator %u\n", policy_names[p], result, legacy_result);
+            ok = false;
+        }
+    }
+
+    printf("\n%-12s | %8s %12s %12s\n", "handshake", "p50 ms", "peak KB", "validator B");
+    for (int p = policy_insecure; p <= policy_fingerprint; p++)
+    {
+        LoopbackClient basic_client;
+        LoopbackServer server(basic_client, loopback_key_rsa);
+        X509List sent;
+        size_t sent_len = 0;
+        add_chain(&server, sent, sent_len);
+
+        ESP_SSLClient2 ssl_client(basic_client);
+        if (p == policy_fingerprint)
+            ssl_client.setFingerprint(fingerprint);
+        else
+            ssl_client.setInsecure();
+        ssl_client.setBufferSizes(16384, 512);
+
+        std::vector<double> us;
+        esp_sslclient_memory_stats_t mem;
+        // The first round is a warm-up
+        for (int i = 0; i <= iterations / 10; i++)
+        {
+            const unsigned long t0 = micros();
+            const bool connected = ssl_client.connect("localhost", 443);
+            if (i > 0)
+                us.push_back(micros() - t0);
+            mem = ssl_client.getMemoryStats();
+            ssl_client.stop();
+            if (!connected)
+            {
+                printf("%s: handshake failed\n", policy_names[p]);
+                return 1;
+            }
+        }
+        // The validator is freed when the handshake completes, so the peak
+        // minus steady state is its size.
+        printf("%-12s | %8.3f %12.1f %12zu\n", policy_names[p], bench_percentile(us, 50) / 1000.0, mem.handshake_peak / 1024.0,
+               mem.handshake_peak - mem.steady_peak);
+    }
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,224 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Suwatchai K. <suwatchai@outlook.com>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+// PEM decoding benchmark.
+//
+// Decodes certificate bundles of growing size (copies of the test roots, and
+// the system CA bundle when one is found) with key_bssl::decode_pem(), which
+// decodes everything into one block sized from the source, next to the
+// previous decode_pem() that grew a Vector one byte at a time per object and
+// then copied it. Reports per decode the time, heap allocations and peak
+// heap, then the same for a whole X509List (decode plus trust anchors).
+//
+// Usage: bench_pem [iterations] [bundle.pem]
+
+#include <ESP_SSLClient.h>
+#include "loopback/TestCredentials.h"
+#include "bench/BenchUtil.h"
+
+#include <string>
+
+using namespace key_bssl;
+
+// The previous decode_pem(): one Vector per object, byte by byte, then a copy.
+static void legacy_append(void *ctx, const void *buff, size_t len)
+{
+    Vector<uint8_t> *vec = static_cast<Vector<uint8_t> *>(ctx);
+    vec->reserve(vec->size() + len);
+    for (size_t i = 0; i < len; i++)
+        vec->push_back((reinterpret_cast<const uint8_t *>(buff))[i]);
+}
+
+static char *legacy_strdup(const char *s)
+{
+    size_t slen = strlen(s);
+    char *result = reinterpret_cast<char *>(esp_sslclient_malloc(slen + 1));
+    if (result)
+        memcpy(result, s, slen + 1);
+    return result;
+}
+
+static pem_object *legacy_decode_pem(const void *src, size_t len, size_t *num)
+{
+    Vector<pem_object> pem_list;
+    ReadyUtils::unique_ptr<br_pem_decoder_context> pc(new br_pem_decoder_context);
+    pem_object po, *pos = nullptr;
+    const unsigned char *buff = reinterpret_cast<const unsigned char *>(src);
+    Vector<uint8_t> bv;
+
+    *num = 0;
+    br_pem_decoder_init(pc.get());
+    po.name = nullptr;
+    po.data = nullptr;
+    po.data_len = 0;
+    bool inobj = false;
+    bool extra_nl = true;
+
+    while (len > 0)
+    {
+        size_t tlen = br_pem_decoder_push(pc.get(), buff, len);
+        buff += tlen;
+        len -= tlen;
+        switch (br_pem_decoder_event(pc.get()))
+        {
+        case BR_PEM_BEGIN_OBJ:
+            po.name = legacy_strdup(br_pem_decoder_name(pc.get()));
+            br_pem_decoder_setdest(pc.get(), legacy_append, &bv);
+            inobj = true;
+            break;
+
+        case BR_PEM_END_OBJ:
+            if (inobj)
+            {
+                po.data = reinterpret_cast<uint8_t *>(esp_sslclient_malloc(bv.size()));
+                if (po.data)
+                {
+                    memcpy(po.data, &bv[0], bv.size());
+                    po.data_len = bv.size();
+                    pem_list.push_back(po);
+                }
+                bv.clear();
+                po.name = nullptr;
+                po.data = nullptr;
+                po.data_len = 0;
+                inobj = false;
+            }
+            break;
+
+        case BR_PEM_ERROR:
+            return nullptr;
+
+        default:
+            break;
+        }
+
+        if (len == 0 && extra_nl)
+        {
+            extra_nl = false;
+            buff = reinterpret_cast<const unsigned char *>("\n");
+            len = 1;
+        }
+    }
+
+    pos = reinterpret_cast<pem_object *>(esp_sslclient_malloc((1 + pem_list.size()) * sizeof(*pos)));
+    if (pos)
+    {
+        *num = pem_list.size();
+        pem_list.push_back(po);
+        memcpy(pos, &pem_list[0], pem_list.size() * sizeof(*pos));
+    }
+    return pos;
+}
+
+static void legacy_free(pem_object *pos)
+{
+    for (size_t u = 0; pos && pos[u].name; u++)
+    {
+        esp_sslclient_free(&pos[u].name);
+        esp_sslclient_free(&pos[u].data);
+    }
+    esp_sslclient_free(&pos);
+}
+
+struct decode_result
+{
+    double us = 0;
+    double allocs = 0;
+    long peak = 0;
+    size_t objects = 0;
+    size_t bytes = 0;
+};
+
+template <typename F>
+static decode_result measure(int iterations, F fn)
+{
+    decode_result r;
+    for (int i = 0; i < iterations; i++)
+    {
+        const size_t allocs = bench_heap.allocs;
+        bench_heap_reset_peak();
+        const long heap = bench_heap.current;
+        const unsigned long t0 = micros();
+        fn(r);
+        r.us += micros() - t0;
+        r.allocs += bench_heap.allocs - allocs;
+        r.peak = std::max(r.peak, bench_heap.peak - heap);
+    }
+    r.us /= iterations;
+    r.allocs /= iterations;
+    return r;
+}
+
+static bool run(const char *name, const std::string &pem, int iterations)
+{
+    const decode_result legacy = measure(iterations, [&](decode_result &r)
+                                         {
+        size_t num;
+        pem_object *pos = legacy_decode_pem(pem.data(), pem.size(), &num);
+        r.objects = num;
+        r.bytes = 0;
+        for (size_t u = 0; u < num; u++)
+            r.bytes += pos[u].data_len;
+        legacy_free(pos); });
+
+    const decode_result arena = measure(iterations, [&](decode_result &r)
+                                        {
+        size_t num;
+        pem_object *pos = decode_pem(pem.data(), pem.size(), &num);
+        r.objects = num;
+        r.bytes = 0;
+        for (size_t u = 0; u < num; u++)
+            r.bytes += pos[u].data_len;
+        free_pem_object(pos); });
+
+    const decode_result list = measure(iterations, [&](decode_result &r)
+                                       {
+        X509List certs;
+        certs.append(reinterpret_cast<const uint8_t *>(pem.data()), pem.size());
+        r.objects = certs.getCount(); });
+
+    if (legacy.objects != arena.objects || legacy.bytes != arena.bytes || list.objects != arena.objects)
+    {
+        printf("%s: decoders disagree (%zu/%zu objects, %zu/%zu bytes)\n", name, legacy.objects, arena.objects, legacy.bytes, arena.bytes);
+        return false;
+    }
+
+    printf("%-10s %5zu %8.1f | %9.1f %7.0f %7.1f | %9.1f %7.0f %7.1f | %9.1f %7.0f %7.1f\n", name, arena.objects, pem.size() / 1024.0,
+           legacy.us, legacy.allocs, legacy.peak / 1024.0, arena.us, arena.allocs, arena.peak / 1024.0, list.us, list.allocs, list.peak / 1024.0);
+    return true;
+}
+
+int main(int argc, char **argv)
+{
+    const int iterations = argc > 1 ? atoi(argv[1]) : 20;
+    const char *system_bundle = argc > 2 ? argv[2] : "/etc/ssl/certs/ca-certificates.crt";
+
+    printf("%-10s %5s %8s | %-25s | %-25s | %-25s\n", "", "", "", "previous decode_pem", "decode_pem", "X509List");
+    printf("%-10s %5s %8s | %9s %7s %7s | %9s %7s %7s | %9s %7s %7s\n", "bundle", "certs", "PEM KB", "us", "allocs", "peak KB", "us", "allocs", "peak KB", "us", "allocs", "peak KB");
+
+    bool ok = true;
+    const size_t copies[] = {1, 10, 100};
+    for (size_t i = 0; i < sizeof(copies) / sizeof(copies[0]); i++)
+    {
+        std::string pem;
+        for (size_t c = 0; c < copies[i]; c++)
+            pem += std::string(host_ec_root_cert) + host_rsa_root_cert;
+        ok = run(("test x" + std::to_string(copies[i])).c_str(), pem, iterations) && ok;
+    }
+
+    FILE *f = fopen(system_bundle, "rb");
+    if (f)
+    {
+        std::string pem;
+        char buf[4096];
+        size_t n;
+        while ((n = fread(buf, 1, sizeof(buf), f)) > 0)
+            pem.append(buf, n);
+        fclose(f);
+        ok = run("system", pem, iterations) && ok;
+    }
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,175 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Suwatchai K. <suwatchai@outlook.com>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+// Cipher profile benchmark.
+//
+// Built once per cipher profile (SSLCLIENT_SUITES_*, none for the full
+// suites_P list). Reports the suites offered, the engines
+// br_ssl_client_base_init() wires up and its time, then the p50 handshake
+// time of the ECDHE suites each profile can hold. The code size of each
+// profile is that of the matching profile_size_* program.
+//
+// Usage: bench_profile_<profile> [iterations]
+
+#include <ESP_SSLClient.h>
+#include "loopback/LoopbackServer.h"
+#include "bench/BenchUtil.h"
+
+#if defined(SSLCLIENT_SUITES_ECDHE_ECDSA_CHACHA20) && !defined(SSLCLIENT_SUITES_ECDHE_RSA_AES128_GCM)
+static const char *profile_name = "ECDHE_ECDSA_CHACHA20";
+#elif defined(SSLCLIENT_SUITES_ECDHE_RSA_AES128_GCM) && !defined(SSLCLIENT_SUITES_ECDHE_ECDSA_CHACHA20)
+static const char *profile_name = "ECDHE_RSA_AES128_GCM";
+#elif defined(SSLCLIENT_CIPHER_PROFILE)
+static const char *profile_name = "custom";
+#else
+static const char *profile_name = "full";
+#endif
+
+struct hs_suite
+{
+    const char *label;
+    uint16_t suite;
+    loopback_server_key key;
+};
+
+static const hs_suite hs_suites[] = {
+    {"ECDHE_ECDSA_CHACHA20_POLY1305", BR_TLS_ECDHE_ECDSA_WITH_CHACHA20_POLY1305_SHA256, loopback_key_ec},
+    {"ECDHE_RSA_CHACHA20_POLY1305", BR_TLS_ECDHE_RSA_WITH_CHACHA20_POLY1305_SHA256, loopback_key_rsa},
+    {"ECDHE_ECDSA_AES_128_GCM", BR_TLS_ECDHE_ECDSA_WITH_AES_128_GCM_SHA256, loopback_key_ec},
+    {"ECDHE_RSA_AES_128_GCM", BR_TLS_ECDHE_RSA_WITH_AES_128_GCM_SHA256, loopback_key_rsa}};
+
+static bool offered(uint16_t suite)
+{
+    for (size_t i = 0; i < sizeof(suites_P) / sizeof(suites_P[0]); i++)
+    {
+        if (suites_P[i] == suite)
+            return true;
+    }
+    return false;
+}
+
+// Engines installed by br_ssl_client_base_init()
+static void print_engines(const br_ssl_client_context &cc)
+{
+    const br_ssl_engine_context &eng = cc.eng;
+    struct slot
+    {
+        const char *name;
+        bool set;
+    };
+    const slot slots[] = {{"rsapub", cc.irsapub != nullptr},
+                          {"rsavrfy", eng.irsavrfy != nullptr},
+                          {"ec", eng.iec != nullptr},
+                          {"ecdsa", eng.iecdsa != nullptr},
+                          {"prf10", eng.prf10 != nullptr},
+                          {"prf_sha256", eng.prf_sha256 != nullptr},
+                          {"prf_sha384", eng.prf_sha384 != nullptr},
+                          {"cbc", eng.icbc_in != nullptr},
+                          {"gcm", eng.igcm_in != nullptr},
+                          {"ccm", eng.iccm_in != nullptr},
+                          {"chapol", eng.ichapol_in != nullptr},
+                          {"des", eng.ides_cbcenc != nullptr}};
+    printf("engines:");
+    for (size_t i = 0; i < sizeof(slots) / sizeof(slots[0]); i++)
+    {
+        if (slots[i].set)
+            printf(" %s", slots[i].name);
+    }
+    printf("\nhashes:");
+    const char *hash_names[] = {"", "md5", "sha1", "sha224", "sha256", "sha384", "sha512"};
+    for (int id = br_md5_ID; id <= br_sha512_ID; id++)
+    {
+        if (br_multihash_getimpl(&eng.mhash, id))
+            printf(" %s", hash_names[id]);
+    }
+    printf("\n");
+}
+
+static bool run_handshake(const hs_suite &s, int iterations)
+{
+    LoopbackClient basic_client;
+    LoopbackServer server(basic_client, s.key);
+    ESP_SSLClient2 ssl_client(basic_client);
+    X509List ta(server.rootCert());
+    ssl_client.setTrustAnchors(&ta);
+    ssl_client.setX509Time(time(nullptr));
+    ssl_client.setCiphers(&s.suite, 1);
+
+    std::vector<double> client_us;
+    // The first round is a warm-up
+    for (int i = 0; i <= iterations; i++)
+    {
+        server.resetCounters();
+        const unsigned long t0 = micros();
+        const bool ok = ssl_client.connect("localhost", 443) && server.cipherSuite() == s.suite;
+        const unsigned long t = micros() - t0;
+        ssl_client.stop();
+        if (!ok)
+        {
+            printf("%-30s handshake failed\n", s.label);
+            return false;
+        }
+        if (i > 0)
+            client_us.push_back(t > server.busyMicros() ? t - server.busyMicros() : 0);
+    }
+    printf("%-30s %10.3f\n", s.label, bench_percentile(client_us, 50) / 1000.0);
+    return true;
+}
+
+// A suite outside of the profile is dropped from setCiphers() lists, so
+// offering only that one fails with a profile and connects without.
+static bool run_outside_profile()
+{
+    const uint16_t suite = BR_TLS_RSA_WITH_AES_128_CBC_SHA256;
+    LoopbackClient basic_client;
+    LoopbackServer server(basic_client, loopback_key_rsa);
+    ESP_SSLClient2 ssl_client(basic_client);
+    ssl_client.setInsecure();
+    ssl_client.setCiphers(&suite, 1);
+    const bool connected = ssl_client.connect("localhost", 443);
+    ssl_client.stop();
+#if defined(SSLCLIENT_CIPHER_PROFILE)
+    const bool expected = false;
+#else
+    const bool expected = true;
+#endif
+    if (connected != expected)
+    {
+        printf("RSA_AES_128_CBC_SHA256 %s\n", connected ? "connected outside of the profile" : "failed");
+        return false;
+    }
+    return true;
+}
+
+int main(int argc, char **argv)
+{
+    const int iterations = argc > 1 && atoi(argv[1]) > 0 ? atoi(argv[1]) : 50;
+    const size_t suite_count = sizeof(suites_P) / sizeof(suites_P[0]);
+
+    printf("profile: %s, %zu suites offered, br_ssl_client_context %zu bytes\n", profile_name, suite_count, sizeof(br_ssl_client_context));
+
+    br_ssl_client_context *cc = static_cast<br_ssl_client_context *>(malloc(sizeof(br_ssl_client_context)));
+    bssl::br_ssl_client_base_init(cc, suites_P, suite_count);
+    print_engines(*cc);
+
+    const int init_rounds = iterations * 200;
+    const unsigned long t0 = micros();
+    for (int i = 0; i < init_rounds; i++)
+        bssl::br_ssl_client_base_init(cc, suites_P, suite_count);
+    printf("base init: %.3f us\n\n", (micros() - t0) / (double)init_rounds);
+    free(cc);
+
+    printf("%-30s %10s\n", "suite", "client p50 ms");
+    bool ok = true;
+    for (size_t i = 0; i < sizeof(hs_suites) / sizeof(hs_suites[0]); i++)
+    {
+        if (offered(hs_suites[i].suite))
+            ok = run_handshake(hs_suites[i], iterations) && ok;
+        else
+            printf("%-30s %10s\n", hs_suites[i].label, "-");
+    }
+    return run_outside_profile() && ok ? 0 : 1;
+}
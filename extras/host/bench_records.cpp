@@ -0,0 +1,438 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Suwatchai K. <suwatchai@outlook.com>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+// Record layer throughput benchmark.
+//
+// Encrypts and decrypts application data records with the BearSSL record
+// engines (br_sslrec_out_gcm_vtable, br_sslrec_out_chapol_vtable,
+// br_sslrec_out_ccm_vtable, br_sslrec_out_cbc_vtable and their in
+// counterparts) for every backend combination compiled into src/bssl, at
+// 512 B, 4 KB and 16 KB records. No handshake is involved, the keys are fixed.
+//
+// Rows marked with '*' use the backends br_ssl_client_base_init() installs on
+// this machine. The summary checks them against the fastest row of each mode
+// and times the record engine setup of a connect(), with BearSSL's defaults
+// (CPU probed on each call) and with the backends the library probed once.
+//
+// The ChaCha20 backends are also run alone on buffers of 64 B to 16 KB, after
+// checking their output and returned counter against chacha20_ct.
+//
+// Usage: bench_records [milliseconds per measurement]
+
+#include <ESP_SSLClient.h>
+#include <vector>
+
+struct aes_backend
+{
+    const char *name;
+    const br_block_ctr_class *ctr;
+    const br_block_ctrcbc_class *ctrcbc;
+    const br_block_cbcenc_class *cbcenc;
+    const br_block_cbcdec_class *cbcdec;
+};
+
+struct ghash_backend
+{
+    const char *name;
+    br_ghash run;
+};
+
+struct chacha_backend
+{
+    const char *name;
+    br_chacha20_run run;
+};
+
+struct poly_backend
+{
+    const char *name;
+    br_poly1305_run run;
+};
+
+// TLS content type of application data records.
+static const int record_type_app = 23;
+
+static const size_t record_sizes[] = {512, 4096, 16384};
+
+static const size_t record_sizes_cnt = sizeof(record_sizes) / sizeof(record_sizes[0]);
+
+// Enough room for the header, explicit IV, MAC, padding and a 16 KB record.
+static unsigned char record_buf[BR_SSL_BUFSIZE_OUTPUT + 512];
+
+static unsigned long measure_ms = 50;
+
+static br_ssl_client_context default_cc;
+
+// Fastest and selected backend of a mode, by 16 KB encryption MB/s
+struct mode_result
+{
+    const char *mode;
+    char fastest[64];
+    double fastest_mbps;
+    char selected[64];
+    double selected_mbps;
+};
+
+static std::vector<mode_result> results;
+
+// Encrypt/decrypt pair sharing the same keys, so records produced by out can
+// be checked by in with matching sequence numbers.
+struct record_pair
+{
+    const br_sslrec_out_class **out;
+    const br_sslrec_in_class **in;
+};
+
+struct throughput
+{
+    double enc_mbps;
+    double dec_mbps;
+    bool ok;
+};
+
+static throughput run_record(const record_pair &p, size_t size)
+{
+    throughput res = {0, 0, true};
+    std::vector<unsigned char> plain(size);
+    for (size_t i = 0; i < size; i++)
+        plain[i] = (unsigned char)i;
+
+    size_t start = 5, end = sizeof(record_buf);
+    (*p.out)->max_plaintext(p.out, &start, &end);
+    if (end - start < size)
+    {
+        res.ok = false;
+        return res;
+    }
+
+    unsigned long enc_us = 0, dec_us = 0;
+    size_t bytes = 0;
+    const unsigned long begin = millis();
+    while (millis() - begin < measure_ms)
+    {
+        memcpy(record_buf + start, plain.data(), size);
+
+        size_t len = size;
+        unsigned long t0 = micros();
+        unsigned char *rec = (*p.out)->encrypt(p.out, record_type_app, BR_TLS12, record_buf + start, &len);
+        enc_us += micros() - t0;
+
+        size_t plen = len - 5;
+        t0 = micros();
+        unsigned char *dec = (*p.in)->decrypt(p.in, record_type_app, BR_TLS12, rec + 5, &plen);
+        dec_us += micros() - t0;
+
+        if (!dec || plen != size || memcmp(dec, plain.data(), size) != 0)
+        {
+            res.ok = false;
+            return res;
+        }
+        bytes += size;
+    }
+
+    res.enc_mbps = bytes / (enc_us ? (double)enc_us : 1.0);
+    res.dec_mbps = bytes / (dec_us ? (double)dec_us : 1.0);
+    return res;
+}
+
+static void print_row(const char *mode, const char *backend, bool is_default, const record_pair *p)
+{
+    printf("%-9s %c %-34s", mode, is_default ? '*' : ' ', backend);
+    if (!p)
+    {
+        printf("  not available on this CPU/build\n");
+        return;
+    }
+    if (results.empty() || strcmp(results.back().mode, mode) != 0)
+    {
+        mode_result r = {mode, "", 0, "none", 0};
+        results.push_back(r);
+    }
+    mode_result &r = results.back();
+    for (size_t i = 0; i < record_sizes_cnt; i++)
+    {
+        throughput t = run_record(*p, record_sizes[i]);
+        if (t.ok)
+            printf(" %8.1f %8.1f", t.enc_mbps, t.dec_mbps);
+        else
+            printf(" %8s %8s", "fail", "fail");
+        if (i + 1 == record_sizes_cnt && t.ok)
+        {
+            if (t.enc_mbps > r.fastest_mbps)
+            {
+                r.fastest_mbps = t.enc_mbps;
+                snprintf(r.fastest, sizeof(r.fastest), "%s", backend);
+            }
+            if (is_default)
+            {
+                r.selected_mbps = t.enc_mbps;
+                snprintf(r.selected, sizeof(r.selected), "%s", backend);
+            }
+        }
+    }
+    printf("\n");
+}
+
+// Mean time of one record engine setup, in microseconds.
+static double time_setup(void (*setup)(br_ssl_engine_context *eng))
+{
+    const int rounds = 2000;
+    const unsigned long t0 = micros();
+    for (int i = 0; i < rounds; i++)
+        setup(&default_cc.eng);
+    return (micros() - t0) / (double)rounds;
+}
+
+static void setup_bearssl_defaults(br_ssl_engine_context *eng)
+{
+    br_ssl_engine_set_default_aes_cbc(eng);
+    br_ssl_engine_set_default_aes_gcm(eng);
+    br_ssl_engine_set_default_aes_ccm(eng);
+    br_ssl_engine_set_default_chapol(eng);
+}
+
+static void setup_probed_once(br_ssl_engine_context *eng) { bssl::br_ssl_engine_set_record_backends(eng); }
+
+// The selected path against the fastest measured one, then the setup cost.
+static void print_summary()
+{
+    printf("\nCPU: AES-NI %s, PCLMUL %s, SSE2 %s, AVX2 %s\n", br_aes_x86ni_ctr_get_vtable() ? "yes" : "no",
+           br_ghash_pclmul_get() ? "yes" : "no", br_chacha20_sse2_get() ? "yes" : "no", br_chacha20_avx2_get() ? "yes" : "no");
+    printf("%-9s   %-34s %8s   %-34s %8s\n", "mode", "selected", "16 KB", "fastest", "16 KB");
+    for (size_t i = 0; i < results.size(); i++)
+    {
+        const mode_result &r = results[i];
+        // Within 10% is measurement noise
+        const bool slower = r.selected_mbps < r.fastest_mbps * 0.9;
+        printf("%-9s   %-34s %8.1f   %-34s %8.1f%s\n", r.mode, r.selected, r.selected_mbps, r.fastest, r.fastest_mbps,
+               slower ? "  selected is slower" : "");
+    }
+    printf("\nrecord engine setup per connect(): BearSSL defaults %.3f us, probed once %.3f us\n", time_setup(setup_bearssl_defaults),
+           time_setup(setup_probed_once));
+}
+
+static const unsigned char key[32] = {
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+    0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f};
+
+static const unsigned char iv[16] = {
+    0xa0, 0xa1, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7, 0xa8, 0xa9, 0xaa, 0xab, 0xac, 0xad, 0xae, 0xaf};
+
+static void bench_gcm(const aes_backend *aes, size_t aes_cnt, const ghash_backend *gh, size_t gh_cnt)
+{
+    for (size_t a = 0; a < aes_cnt; a++)
+    {
+        for (size_t g = 0; g < gh_cnt; g++)
+        {
+            char name[64];
+            snprintf(name, sizeof(name), "%s + %s", aes[a].name, gh[g].name);
+            const bool is_default = aes[a].ctr && aes[a].ctr == default_cc.eng.iaes_ctr && gh[g].run == default_cc.eng.ighash;
+            if (!aes[a].ctr || !gh[g].run)
+            {
+                print_row("GCM", name, false, nullptr);
+                continue;
+            }
+            br_sslrec_gcm_context out, in;
+            br_sslrec_out_gcm_vtable.init(&out.vtable.out, aes[a].ctr, key, 16, gh[g].run, iv);
+            br_sslrec_in_gcm_vtable.init(&in.vtable.in, aes[a].ctr, key, 16, gh[g].run, iv);
+            record_pair p = {(const br_sslrec_out_class **)&out.vtable.out, (const br_sslrec_in_class **)&in.vtable.in};
+            print_row("GCM", name, is_default, &p);
+        }
+    }
+}
+
+static void bench_chapol(const chacha_backend *cc, size_t cc_cnt, const poly_backend *poly, size_t poly_cnt)
+{
+    for (size_t c = 0; c < cc_cnt; c++)
+    {
+        for (size_t i = 0; i < poly_cnt; i++)
+        {
+            char name[64];
+            snprintf(name, sizeof(name), "%s + %s", cc[c].name, poly[i].name);
+            const bool is_default = cc[c].run && cc[c].run == default_cc.eng.ichacha && poly[i].run == default_cc.eng.ipoly;
+            if (!cc[c].run || !poly[i].run)
+            {
+                print_row("ChaPol", name, false, nullptr);
+                continue;
+            }
+            br_sslrec_chapol_context out, in;
+            br_sslrec_out_chapol_vtable.init(&out.vtable.out, cc[c].run, poly[i].run, key, iv);
+            br_sslrec_in_chapol_vtable.init(&in.vtable.in, cc[c].run, poly[i].run, key, iv);
+            record_pair p = {(const br_sslrec_out_class **)&out.vtable.out, (const br_sslrec_in_class **)&in.vtable.in};
+            print_row("ChaPol", name, is_default, &p);
+        }
+    }
+}
+
+// Same keystream and returned counter as chacha20_ct, for lengths around the
+// block and eight block boundaries and a counter that wraps around.
+static bool check_chacha20(const chacha_backend &c)
+{
+    const uint32_t counters[] = {0, 1, 0xfffffffcU};
+    std::vector<unsigned char> ref(2048), out(2048);
+    for (size_t k = 0; k < sizeof(counters) / sizeof(counters[0]); k++)
+    {
+        for (size_t len = 0; len <= ref.size(); len += len < 1100 ? 1 : 61)
+        {
+            for (size_t i = 0; i < len; i++)
+                ref[i] = out[i] = (unsigned char)(i * 7);
+            const uint32_t ref_cc = br_chacha20_ct_run(key, iv, counters[k], ref.data(), len);
+            const uint32_t cc = c.run(key, iv, counters[k], out.data(), len);
+            if (cc != ref_cc || memcmp(ref.data(), out.data(), len) != 0)
+            {
+                printf("%s: mismatch with chacha20_ct, counter %u, %zu bytes\n", c.name, (unsigned)counters[k], len);
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+// Raw ChaCha20 MB/s, without Poly1305 or the record framing.
+static bool bench_chacha20(const chacha_backend *cc, size_t cc_cnt)
+{
+    const size_t sizes[] = {64, 512, 4096, 16384};
+    const size_t sizes_cnt = sizeof(sizes) / sizeof(sizes[0]);
+    std::vector<unsigned char> buf(16384);
+
+    printf("\nChaCha20 alone, MB/s\n%-9s   %-34s", "", "backend");
+    for (size_t i = 0; i < sizes_cnt; i++)
+    {
+        char col[32];
+        snprintf(col, sizeof(col), "%zu B", sizes[i]);
+        printf(" %8s", col);
+    }
+    printf("\n");
+
+    bool ok = true;
+    for (size_t c = 0; c < cc_cnt; c++)
+    {
+        const bool is_default = cc[c].run && cc[c].run == default_cc.eng.ichacha;
+        printf("%-9s %c %-34s", "ChaCha20", is_default ? '*' : ' ', cc[c].name);
+        if (!cc[c].run)
+        {
+            printf("  not available on this CPU/build\n");
+            continue;
+        }
+        if (!check_chacha20(cc[c]))
+        {
+            ok = false;
+            continue;
+        }
+        for (size_t i = 0; i < sizes_cnt; i++)
+        {
+            size_t bytes = 0;
+            uint32_t counter = 1;
+            const unsigned long begin = millis();
+            const unsigned long t0 = micros();
+            while (millis() - begin < measure_ms)
+            {
+                counter = cc[c].run(key, iv, counter, buf.data(), sizes[i]);
+                bytes += sizes[i];
+            }
+            const unsigned long us = micros() - t0;
+            printf(" %8.1f", bytes / (us ? (double)us : 1.0));
+        }
+        printf("\n");
+    }
+    return ok;
+}
+
+static void bench_ccm(const aes_backend *aes, size_t aes_cnt)
+{
+    for (size_t a = 0; a < aes_cnt; a++)
+    {
+        const bool is_default = aes[a].ctrcbc && aes[a].ctrcbc == default_cc.eng.iaes_ctrcbc;
+        if (!aes[a].ctrcbc)
+        {
+            print_row("CCM", aes[a].name, false, nullptr);
+            continue;
+        }
+        br_sslrec_ccm_context out, in;
+        br_sslrec_out_ccm_vtable.init(&out.vtable.out, aes[a].ctrcbc, key, 16, iv, 16);
+        br_sslrec_in_ccm_vtable.init(&in.vtable.in, aes[a].ctrcbc, key, 16, iv, 16);
+        record_pair p = {(const br_sslrec_out_class **)&out.vtable.out, (const br_sslrec_in_class **)&in.vtable.in};
+        print_row("CCM", aes[a].name, is_default, &p);
+    }
+}
+
+static void bench_cbc(const aes_backend *aes, size_t aes_cnt)
+{
+    for (size_t a = 0; a < aes_cnt; a++)
+    {
+        char name[64];
+        snprintf(name, sizeof(name), "%s + hmac_sha256", aes[a].name);
+        const bool is_default = aes[a].cbcenc && aes[a].cbcenc == default_cc.eng.iaes_cbcenc;
+        if (!aes[a].cbcenc || !aes[a].cbcdec)
+        {
+            print_row("CBC", name, false, nullptr);
+            continue;
+        }
+        // TLS 1.2 uses explicit per-record IVs, so no initial IV is given.
+        br_sslrec_out_cbc_context out;
+        br_sslrec_in_cbc_context in;
+        br_sslrec_out_cbc_vtable.init(&out.vtable, aes[a].cbcenc, key, 16, &br_sha256_vtable, key, 32, 32, nullptr);
+        br_sslrec_in_cbc_vtable.init(&in.vtable, aes[a].cbcdec, key, 16, &br_sha256_vtable, key, 32, 32, nullptr);
+        record_pair p = {(const br_sslrec_out_class **)&out.vtable, (const br_sslrec_in_class **)&in.vtable};
+        print_row("CBC", name, is_default, &p);
+    }
+}
+
+int main(int argc, char **argv)
+{
+    if (argc > 1 && atoi(argv[1]) > 0)
+        measure_ms = atoi(argv[1]);
+
+    // Record the backends the library would pick on this machine.
+    bssl::br_ssl_client_base_init(&default_cc, suites_P, sizeof(suites_P) / sizeof(suites_P[0]));
+
+    const aes_backend aes[] = {
+        {"aes_big", &br_aes_big_ctr_vtable, &br_aes_big_ctrcbc_vtable, &br_aes_big_cbcenc_vtable, &br_aes_big_cbcdec_vtable},
+        {"aes_small", &br_aes_small_ctr_vtable, &br_aes_small_ctrcbc_vtable, &br_aes_small_cbcenc_vtable, &br_aes_small_cbcdec_vtable},
+        {"aes_ct", &br_aes_ct_ctr_vtable, &br_aes_ct_ctrcbc_vtable, &br_aes_ct_cbcenc_vtable, &br_aes_ct_cbcdec_vtable},
+        {"aes_ct64", &br_aes_ct64_ctr_vtable, &br_aes_ct64_ctrcbc_vtable, &br_aes_ct64_cbcenc_vtable, &br_aes_ct64_cbcdec_vtable},
+        {"aes_x86ni", br_aes_x86ni_ctr_get_vtable(), br_aes_x86ni_ctrcbc_get_vtable(), br_aes_x86ni_cbcenc_get_vtable(), br_aes_x86ni_cbcdec_get_vtable()},
+        {"aes_pwr8", br_aes_pwr8_ctr_get_vtable(), br_aes_pwr8_ctrcbc_get_vtable(), br_aes_pwr8_cbcenc_get_vtable(), br_aes_pwr8_cbcdec_get_vtable()}};
+
+    const ghash_backend gh[] = {
+        {"ghash_ctmul", &br_ghash_ctmul},
+        {"ghash_ctmul32", &br_ghash_ctmul32},
+        {"ghash_ctmul64", &br_ghash_ctmul64},
+        {"ghash_pclmul", br_ghash_pclmul_get()},
+        {"ghash_pwr8", br_ghash_pwr8_get()}};
+
+    const chacha_backend cc[] = {
+        {"chacha20_ct", &br_chacha20_ct_run},
+        {"chacha20_sse2", br_chacha20_sse2_get()},
+        {"chacha20_avx2", br_chacha20_avx2_get()}};
+
+    const poly_backend poly[] = {
+        {"poly1305_ctmul", &br_poly1305_ctmul_run},
+        {"poly1305_ctmul32", &br_poly1305_ctmul32_run},
+        {"poly1305_ctmulq", br_poly1305_ctmulq_get()},
+        {"poly1305_i15", &br_poly1305_i15_run}};
+
+    printf("MB/s, AES-128 keys, %lu ms per measurement, '*' = default backend on this machine\n", measure_ms);
+    printf("%-9s   %-34s", "", "");
+    for (size_t i = 0; i < record_sizes_cnt; i++)
+    {
+        char col[32];
+        snprintf(col, sizeof(col), "%zu B", record_sizes[i]);
+        printf(" %17s", col);
+    }
+    printf("\n%-9s   %-34s", "mode", "backend");
+    for (size_t i = 0; i < record_sizes_cnt; i++)
+        printf(" %8s %8s", "enc", "dec");
+    printf("\n");
+
+    bench_gcm(aes, sizeof(aes) / sizeof(aes[0]), gh, sizeof(gh) / sizeof(gh[0]));
+    bench_chapol(cc, sizeof(cc) / sizeof(cc[0]), poly, sizeof(poly) / sizeof(poly[0]));
+    bench_ccm(aes, sizeof(aes) / sizeof(aes[0]));
+    bench_cbc(aes, sizeof(aes) / sizeof(aes[0]));
+    const bool ok = bench_chacha20(cc, sizeof(cc) / sizeof(cc[0]));
+    print_summary();
+    return ok ? 0 : 1;
+}
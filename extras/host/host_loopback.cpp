@@ -0,0 +1,619 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Suwatchai K. <suwatchai@outlook.com>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+// Drives BSSL_SSLClient against the loopback BearSSL server: one verified
+// handshake per key type followed by bulk, zero-copy and Stream uploads and
+// bulk and zero-copy downloads, then the async, pool, session cache, trust
+// anchor bundle, pinning and allocator checks.
+// Exit code is non-zero if any step fails.
+
+#include <ESP_SSLClient.h>
+#include "loopback/LoopbackServer.h"
+#include "loopback/TestTrustAnchors.h"
+
+static const size_t bulk_size = 1024 * 1024;
+
+// Read-only Stream over a memory block, the source of the write(Stream &) upload.
+class MemoryStream : public Stream
+{
+public:
+    MemoryStream(const uint8_t *data, size_t len) : _data(data), _len(len) {}
+
+    int available() override { return (int)(_len - _pos); }
+    int read() override { return _pos < _len ? _data[_pos++] : -1; }
+    int peek() override { return _pos < _len ? _data[_pos] : -1; }
+    size_t write(uint8_t) override { return 0; }
+
+private:
+    const uint8_t *_data;
+    size_t _len;
+    size_t _pos = 0;
+};
+
+static void stream_progress(size_t written, size_t total, void *arg)
+{
+    (void)written;
+    (void)total;
+    (*static_cast<size_t *>(arg))++;
+}
+
+static bool run(loopback_server_key key, const char *name)
+{
+    LoopbackClient basic_client;
+    LoopbackServer server(basic_client, key);
+    ESP_SSLClient2 ssl_client(basic_client);
+
+    X509List ta(server.rootCert());
+    ssl_client.setTrustAnchors(&ta);
+    ssl_client.setX509Time(time(nullptr));
+    ssl_client.setBufferSizes(16384, 16384);
+
+    unsigned long t0 = micros();
+    if (!ssl_client.connect("localhost", 443))
+    {
+        printf("%s: handshake failed\n", name);
+        return false;
+    }
+    unsigned long t_hs = micros() - t0;
+
+    // Upload
+    std::vector<uint8_t> chunk(4096);
+    for (size_t i = 0; i < chunk.size(); i++)
+        chunk[i] = (uint8_t)i;
+
+    t0 = micros();
+    for (size_t sent = 0; sent < bulk_size; sent += chunk.size())
+    {
+        if (ssl_client.write(chunk.data(), chunk.size()) != chunk.size())
+        {
+            printf("%s: write failed\n", name);
+            return false;
+        }
+    }
+    // bulk_size is a multiple of the record size, so nothing is left in the
+    // sendapp buffer here; let the server drain the pipe.
+    basic_client.available();
+    unsigned long t_up = micros() - t0;
+    if (server.receivedBytes() != bulk_size)
+    {
+        printf("%s: server received %zu of %zu bytes\n", name, server.receivedBytes(), bulk_size);
+        return false;
+    }
+
+    // Zero-copy upload, serialized straight into the engine buffer
+    server.resetCounters();
+    server.setKeepReceived(true);
+    size_t zc_sent = 0;
+    for (int i = 0; i < 16; i++)
+    {
+        size_t cap = 0;
+        uint8_t *wbuf = ssl_client.getWriteBuffer(&cap);
+        if (!wbuf || cap == 0)
+        {
+            printf("%s: getWriteBuffer failed\n", name);
+            return false;
+        }
+        int n = snprintf(reinterpret_cast<char *>(wbuf), cap, "{\"seq\":%d,\"value\":%d}", i, i * 3);
+        if (ssl_client.commitWrite(n) != (size_t)n)
+        {
+            printf("%s: commitWrite failed\n", name);
+            return false;
+        }
+        zc_sent += n;
+    }
+    basic_client.available();
+    server.setKeepReceived(false);
+    if (server.receivedBytes() != zc_sent || memcmp(server.received().data(), "{\"seq\":0,", 9) != 0)
+    {
+        printf("%s: zero-copy upload mismatch (%zu of %zu bytes)\n", name, server.receivedBytes(), zc_sent);
+        return false;
+    }
+
+    // Stream upload in 1000 byte chunks
+    server.resetCounters();
+    std::vector<uint8_t> source(64 * 1024 + 123);
+    for (size_t i = 0; i < source.size(); i++)
+        source[i] = (uint8_t)(i * 13);
+    MemoryStream stream(source.data(), source.size());
+    size_t progress_calls = 0;
+    ssl_client.setStreamChunkSize(1000);
+    ssl_client.setStreamProgressCallback(stream_progress, &progress_calls);
+    if (ssl_client.write(stream) != source.size())
+    {
+        printf("%s: write(Stream &) failed\n", name);
+        return false;
+    }
+    basic_client.available();
+    // Chunks are also cut at the end of each record, so there may be a few more calls.
+    if (server.receivedBytes() != source.size() || progress_calls < (source.size() + 999) / 1000)
+    {
+        printf("%s: stream upload mismatch (%zu of %zu bytes, %zu progress calls)\n", name, server.receivedBytes(), source.size(), progress_calls);
+        return false;
+    }
+
+    // Download
+    std::vector<uint8_t> payload(bulk_size, 0x5a);
+    server.send(payload.data(), payload.size());
+    size_t got = 0;
+    t0 = micros();
+    while (got < bulk_size)
+    {
+        int n = ssl_client.read(chunk.data(), chunk.size());
+        if (n <= 0)
+        {
+            printf("%s: read failed after %zu bytes\n", name, got);
+            return false;
+        }
+        got += n;
+    }
+    unsigned long t_down = micros() - t0;
+
+    // Zero-copy download, parsed straight out of the decrypted record
+    for (size_t i = 0; i < payload.size(); i++)
+        payload[i] = (uint8_t)(i * 7);
+    const size_t zc_size = 256 * 1024;
+    server.send(payload.data(), zc_size);
+    got = 0;
+    while (got < zc_size)
+    {
+        size_t len = 0;
+        const uint8_t *rbuf = ssl_client.getReadBuffer(&len);
+        if (!rbuf || len == 0 || memcmp(rbuf, payload.data() + got, len) != 0)
+        {
+            printf("%s: zero-copy read failed after %zu bytes\n", name, got);
+            return false;
+        }
+        got += ssl_client.consumeRead(len);
+    }
+
+    printf("%-4s suite 0x%04x  handshake %7.2f ms  upload %7.1f MB/s  download %7.1f MB/s\n",
+           name, server.cipherSuite(), t_hs / 1000.0,
+           bulk_size / (t_up ? (double)t_up : 1.0), bulk_size / (t_down ? (double)t_down : 1.0));
+
+    ssl_client.stop();
+    return true;
+}
+
+// Non-blocking connect: the handshake is only driven by poll(). The server
+// bytes only arrive on the poll after they were sent, so poll() has to
+// return esp_ssl_poll_want_read in between.
+static bool run_async(loopback_server_key key, const char *name)
+{
+    LoopbackClient basic_client;
+    LoopbackServer server(basic_client, key);
+    server.setEcho(true);
+    basic_client.setHoldIncoming(true);
+    ESP_SSLClient2 ssl_client(basic_client);
+
+    X509List ta(server.rootCert());
+    ssl_client.setTrustAnchors(&ta);
+    ssl_client.setX509Time(time(nullptr));
+
+    if (!ssl_client.connectAsync("localhost", 443) || !ssl_client.connecting())
+    {
+        printf("%s: connectAsync failed\n", name);
+        return false;
+    }
+
+    int polls = 0, want_read = 0, status = esp_ssl_poll_want_read;
+    const unsigned long start = millis();
+    do
+    {
+        status = ssl_client.poll();
+        polls++;
+        if (status == esp_ssl_poll_want_read)
+            want_read++;
+        basic_client.release();
+    } while (status > esp_ssl_poll_ready && millis() - start < 5000);
+
+    if (status != esp_ssl_poll_ready || !ssl_client.connected() || ssl_client.connecting())
+    {
+        printf("%s: async handshake failed (status %d after %d polls)\n", name, status, polls);
+        return false;
+    }
+    if (polls < 2 || want_read == 0)
+    {
+        printf("%s: async handshake did not wait for the server (%d polls, %d want_read)\n", name, polls, want_read);
+        return false;
+    }
+
+    const char msg[] = "ping";
+    ssl_client.write(reinterpret_cast<const uint8_t *>(msg), sizeof(msg));
+    ssl_client.flush();
+    char reply[sizeof(msg)] = {0};
+    size_t got = 0;
+    while (got < sizeof(msg) && millis() - start < 5000)
+    {
+        if (ssl_client.poll() < esp_ssl_poll_ready)
+            break;
+        basic_client.release();
+        if (ssl_client.available() > 0)
+            got += ssl_client.read(reinterpret_cast<uint8_t *>(reply) + got, sizeof(reply) - got);
+    }
+    if (got != sizeof(msg) || strcmp(reply, msg) != 0)
+    {
+        printf("%s: async echo failed\n", name);
+        return false;
+    }
+
+    printf("%-4s async handshake in %d polls\n", name, polls);
+    ssl_client.stop();
+    return true;
+}
+
+// One echo request over a pooled client.
+static bool pool_request(BSSL_TCPClient *c)
+{
+    const char msg[] = "GET";
+    c->write(reinterpret_cast<const uint8_t *>(msg), sizeof(msg));
+    char reply[sizeof(msg)] = {0};
+    size_t got = 0;
+    const unsigned long start = millis();
+    while (got < sizeof(msg) && millis() - start < 5000)
+    {
+        if (c->available() > 0)
+            got += c->read(reinterpret_cast<uint8_t *>(reply) + got, sizeof(reply) - got);
+    }
+    return got == sizeof(msg);
+}
+
+// Connection pool: the second request to the same server reuses the connection.
+static bool run_pool(loopback_server_key key, const char *name)
+{
+    LoopbackClient basic_client[2];
+    LoopbackServer server0(basic_client[0], key), server1(basic_client[1], key);
+    LoopbackServer *servers[2] = {&server0, &server1};
+    ESP_SSLClient2 ssl_client0(basic_client[0]), ssl_client1(basic_client[1]);
+    ESP_SSLClient2 *clients[2] = {&ssl_client0, &ssl_client1};
+    X509List ta(server0.rootCert());
+
+    BSSL_ConnectionPool pool;
+    for (int i = 0; i < 2; i++)
+    {
+        servers[i]->setEcho(true);
+        clients[i]->setTrustAnchors(&ta);
+        clients[i]->setX509Time(time(nullptr));
+        clients[i]->setSessionTimeout(60);
+        pool.add(clients[i]);
+    }
+
+    for (int i = 0; i < 4; i++)
+    {
+        BSSL_TCPClient *c = pool.acquire("localhost", 443);
+        if (!c)
+        {
+            printf("%s: pool acquire failed\n", name);
+            return false;
+        }
+        if (!pool_request(c))
+        {
+            printf("%s: pooled request %d failed\n", name, i);
+            return false;
+        }
+        pool.release(c);
+    }
+
+    // The server hanging up makes the pool open a new connection.
+    basic_client[0].hangup();
+    BSSL_TCPClient *c = pool.acquire("localhost", 443);
+    if (!c)
+    {
+        printf("%s: pool reconnect failed\n", name);
+        return false;
+    }
+    pool.release(c, false);
+
+    // A connection past the session timeout of its client is replaced.
+    for (int i = 0; i < 2; i++)
+    {
+        if (i == 1)
+            host_clock_advance(61 * 1000);
+        c = pool.acquire("localhost", 443);
+        if (!c || !pool_request(c))
+        {
+            printf("%s: pooled request %s the session timeout failed\n", name, i ? "after" : "before");
+            return false;
+        }
+        pool.release(c);
+    }
+
+    if (pool.opened() != 4 || pool.reused() != 3 || server0.accepted() + server1.accepted() != 4)
+    {
+        printf("%s: pool opened %zu, reused %zu, accepted %zu\n", name, pool.opened(), pool.reused(), server0.accepted() + server1.accepted());
+        return false;
+    }
+    printf("%-4s pool: 7 requests, %zu handshakes\n", name, pool.opened());
+    pool.clear();
+    return true;
+}
+
+// Server chain verified with the precompiled trust anchor bundle only: the
+// bundle with both roots is accepted, one without the server root is not.
+static bool run_ta_bundle(loopback_server_key key, const char *name)
+{
+    X509List roots(host_ec_root_cert);
+    roots.append(host_rsa_root_cert);
+    X509List other(key == loopback_key_ec ? host_rsa_root_cert : host_ec_root_cert);
+
+    for (int round = 0; round < 2; round++)
+    {
+        const X509List &list = round == 0 ? roots : other;
+        std::vector<uint8_t> data(BSSL_TrustAnchorBundle::build(list.getTrustAnchors(), list.getCount(), nullptr, 0));
+        BSSL_TrustAnchorBundle bundle;
+        if (data.empty() || BSSL_TrustAnchorBundle::build(list.getTrustAnchors(), list.getCount(), data.data(), data.size()) != data.size() ||
+            !bundle.begin(data.data(), data.size()) || bundle.count() != list.getCount())
+        {
+            printf("%s: trust anchor bundle build failed\n", name);
+            return false;
+        }
+
+        LoopbackClient basic_client;
+        LoopbackServer server(basic_client, key);
+        ESP_SSLClient2 ssl_client(basic_client);
+        ssl_client.setCertStore(&bundle);
+        ssl_client.setX509Time(time(nullptr));
+
+        const bool connected = ssl_client.connect("localhost", 443);
+        ssl_client.stop();
+        if (connected != (round == 0))
+        {
+            printf("%s: trust anchor bundle round %d %s\n", name, round, connected ? "connected" : "failed");
+            return false;
+        }
+        if (round == 0)
+            printf("%-4s trust anchor bundle: %zu roots, %zu bytes\n", name, bundle.count(), data.size());
+    }
+    return true;
+}
+
+// Generated trust anchors (tools/ta_array), the whole array and the
+// other root alone, which must not verify the server.
+static bool run_ta_array(loopback_server_key key, const char *name)
+{
+    const size_t other = key == loopback_key_ec ? 1 : 0;
+    host_trust_anchors_load();
+    for (int round = 0; round < 2; round++)
+    {
+        LoopbackClient basic_client;
+        LoopbackServer server(basic_client, key);
+        ESP_SSLClient2 ssl_client(basic_client);
+        if (round == 0)
+            ssl_client.setTrustAnchors(host_trust_anchors, host_trust_anchors_count);
+        else
+            ssl_client.setTrustAnchors(&host_trust_anchors[other], 1);
+        ssl_client.setX509Time(time(nullptr));
+
+        const bool connected = ssl_client.connect("localhost", 443);
+        ssl_client.stop();
+        if (connected != (round == 0))
+        {
+            printf("%s: const trust anchors round %d %s\n", name, round, connected ? "connected" : "failed");
+            return false;
+        }
+    }
+    printf("%-4s const trust anchors: %zu roots\n", name, host_trust_anchors_count);
+    return true;
+}
+
+// Leaf public key and certificate pins: accepted with a matching pin of the
+// right kind, whatever else the chain holds, rejected otherwise.
+static bool run_pins(loopback_server_key key, const char *name)
+{
+    const uint8_t *other_spki = key == loopback_key_ec ? host_rsa_leaf_spki_sha256 : host_ec_leaf_spki_sha256;
+    uint8_t spki[32];
+    X509List leaf(key == loopback_key_ec ? host_ec_leaf_cert : host_rsa_leaf_cert);
+    if (!bssl::spki_sha256(leaf.getX509Certs()[0].data, leaf.getX509Certs()[0].data_len, spki))
+    {
+        printf("%s: pins: no SPKI found\n", name);
+        return false;
+    }
+
+    for (int round = 0; round < 5; round++)
+    {
+        LoopbackClient basic_client;
+        LoopbackServer server(basic_client, key);
+        // Chain validation would reject this one
+        server.appendChain(host_ec_root_cert);
+        if (memcmp(spki, server.leafSpkiPin(), 32))
+        {
+            printf("%s: pins: SPKI pin differs from OpenSSL\n", name);
+            return false;
+        }
+
+        uint8_t pins[2][32];
+        memcpy(pins[0], other_spki, 32);
+        memcpy(pins[1], round == 0 || round == 3 ? server.leafSpkiPin() : server.leafCertPin(), 32);
+        ESP_SSLClient2 ssl_client(basic_client);
+        if (round == 1 || round == 3)
+            ssl_client.setCertificatePins(pins, 2);
+        else
+            ssl_client.setPublicKeyPins(pins, round == 4 ? 1 : 2);
+
+        const bool connected = ssl_client.connect("localhost", 443);
+        ssl_client.stop();
+        if (connected != (round < 2))
+        {
+            printf("%s: pins round %d %s\n", name, round, connected ? "connected" : "failed");
+            return false;
+        }
+    }
+    printf("%-4s pins: public key and certificate pins\n", name);
+    return true;
+}
+
+// Accounting allocator: a size header before each block.
+struct CountingAllocator
+{
+    size_t allocs = 0;
+    size_t live = 0;
+    size_t peak = 0;
+    esp_sslclient_allocator_t table = {alloc, resize, release, this};
+
+    static void *alloc(void *ctx, size_t len) { return resize(ctx, nullptr, len); }
+
+    static void *resize(void *ctx, void *ptr, size_t len)
+    {
+        CountingAllocator *a = static_cast<CountingAllocator *>(ctx);
+        size_t *p = ptr ? static_cast<size_t *>(ptr) - 2 : nullptr;
+        const size_t old = p ? p[0] : 0;
+        p = static_cast<size_t *>(realloc(p, len + 2 * sizeof(size_t)));
+        if (!p)
+            return nullptr;
+        p[0] = len;
+        a->allocs++;
+        a->live += len - old;
+        a->peak = std::max(a->peak, a->live);
+        return p + 2;
+    }
+
+    static void release(void *ctx, void *ptr)
+    {
+        size_t *p = static_cast<size_t *>(ptr) - 2;
+        static_cast<CountingAllocator *>(ctx)->live -= p[0];
+        free(p);
+    }
+};
+
+// Library allocations through a process-wide allocator and the connection
+// state through a per-client one, all returned after stop(), and the
+// connection memory accounting against the per-client allocator.
+static bool run_allocator(loopback_server_key key, const char *name)
+{
+    CountingAllocator global, conn;
+    esp_sslclient_set_allocator(&global.table);
+    bool ok = true;
+    {
+        LoopbackClient basic_client;
+        LoopbackServer server(basic_client, key);
+        ESP_SSLClient2 ssl_client(basic_client);
+        X509List ta(server.rootCert());
+        ssl_client.setTrustAnchors(&ta);
+        ssl_client.setX509Time(time(nullptr));
+        ssl_client.setAllocator(&conn.table);
+        ssl_client.setBufferSizes(16384, 4096);
+
+        const size_t global_allocs = global.allocs;
+        ok = ssl_client.connect("localhost", 443);
+        const esp_sslclient_memory_stats_t hs = ssl_client.getMemoryStats();
+        const size_t conn_live = conn.live;
+
+        // application records larger than the handshake ones each way
+        std::vector<uint8_t> data(6000, 0x33);
+        server.send(data.data(), data.size());
+        size_t got = 0;
+        while (ok && got < data.size())
+        {
+            int n = ssl_client.read(data.data(), data.size());
+            ok = n > 0;
+            got += n > 0 ? n : 0;
+        }
+        ok = ok && ssl_client.write(data.data(), data.size()) == data.size();
+        const esp_sslclient_memory_stats_t mem = ssl_client.getMemoryStats();
+        ssl_client.stop();
+        if (!ok || conn.allocs == 0 || conn.live != 0 || global_allocs == 0)
+        {
+            printf("%s: allocator %s, %zu connection allocations, %zu bytes not freed\n", name, ok ? "connected" : "failed", conn.allocs, conn.live);
+            ok = false;
+        }
+        else if (hs.validator != 0 || hs.current == 0 || hs.current > conn_live || hs.handshake_peak <= hs.steady_peak ||
+                 hs.credentials == 0 || mem.max_record_in < 4096 || mem.max_record_out < 4096)
+        {
+            printf("%s: memory stats: current %zu (allocator %zu), validator %zu, credentials %zu, peaks %zu/%zu, records %zu/%zu\n", name,
+                   hs.current, conn_live, hs.validator, hs.credentials, hs.handshake_peak, hs.steady_peak, mem.max_record_in, mem.max_record_out);
+            ok = false;
+        }
+        else
+            printf("%-4s memory: handshake peak %.1f KB, steady %.1f KB, credentials %zu bytes, max record in %zu out %zu\n", name,
+                   hs.handshake_peak / 1024.0, hs.steady_peak / 1024.0, hs.credentials, mem.max_record_in, mem.max_record_out);
+    }
+    esp_sslclient_set_allocator(nullptr);
+    if (ok && global.live != 0)
+    {
+        printf("%s: allocator %zu bytes not freed\n", name, global.live);
+        ok = false;
+    }
+    if (ok)
+        printf("%-4s allocator: connection %zu allocations, peak %.1f KB; library %zu allocations, peak %.1f KB\n", name,
+               conn.allocs, conn.peak / 1024.0, global.allocs, global.peak / 1024.0);
+    return ok;
+}
+
+// Session cache shared by two clients, restored from its serialized form.
+static bool run_session_cache(loopback_server_key key, const char *name)
+{
+    LoopbackClient basic_client[2];
+    LoopbackServer server0(basic_client[0], key), server1(basic_client[1], key);
+    LoopbackServer *servers[2] = {&server0, &server1};
+    ESP_SSLClient2 ssl_client0(basic_client[0]), ssl_client1(basic_client[1]);
+    ESP_SSLClient2 *clients[2] = {&ssl_client0, &ssl_client1};
+    const uint16_t ports[2] = {443, 8883};
+    X509List ta(server0.rootCert());
+
+    BearSSL_SessionCache cache(4);
+    for (int i = 0; i < 2; i++)
+    {
+        servers[i]->enableSessionCache(true);
+        clients[i]->setTrustAnchors(&ta);
+        clients[i]->setX509Time(time(nullptr));
+        clients[i]->setSessionCache(&cache);
+    }
+
+    // full handshakes, then resumed ones
+    for (int round = 0; round < 2; round++)
+    {
+        for (int i = 0; i < 2; i++)
+        {
+            if (!clients[i]->connect("localhost", ports[i]) || servers[i]->resumed() != (round == 1))
+            {
+                printf("%s: session cache round %d, server %d failed\n", name, round, i);
+                return false;
+            }
+            clients[i]->stop();
+        }
+    }
+
+    std::vector<uint8_t> saved(cache.serializedSize());
+    if (cache.count() != 2 || cache.serialize(saved.data(), saved.size()) != saved.size())
+    {
+        printf("%s: session cache serialize failed\n", name);
+        return false;
+    }
+
+    BearSSL_SessionCache restored(4);
+    if (!restored.deserialize(saved.data(), saved.size()) || restored.count() != 2)
+    {
+        printf("%s: session cache deserialize failed\n", name);
+        return false;
+    }
+    ssl_client1.setSessionCache(&restored);
+    if (!ssl_client1.connect("localhost", ports[1]) || !server1.resumed())
+    {
+        printf("%s: restored session not resumed\n", name);
+        return false;
+    }
+    ssl_client1.stop();
+
+    printf("%-4s session cache: 2 servers resumed, %zu bytes serialized\n", name, saved.size());
+    return true;
+}
+
+int main()
+{
+    bool ok = run(loopback_key_ec, "EC");
+    ok = run(loopback_key_rsa, "RSA") && ok;
+    ok = run_async(loopback_key_ec, "EC") && ok;
+    ok = run_async(loopback_key_rsa, "RSA") && ok;
+    ok = run_pool(loopback_key_ec, "EC") && ok;
+    ok = run_session_cache(loopback_key_ec, "EC") && ok;
+    ok = run_ta_bundle(loopback_key_ec, "EC") && ok;
+    ok = run_ta_bundle(loopback_key_rsa, "RSA") && ok;
+    ok = run_ta_array(loopback_key_ec, "EC") && ok;
+    ok = run_ta_array(loopback_key_rsa, "RSA") && ok;
+    ok = run_pins(loopback_key_ec, "EC") && ok;
+    ok = run_pins(loopback_key_rsa, "RSA") && ok;
+    ok = run_allocator(loopback_key_ec, "EC") && ok;
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,126 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Suwatchai K. <suwatchai@outlook.com>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+// Session ticket (RFC 5077) resumption against an OpenSSL server that keeps
+// no session cache: with a BearSSL_Session, with a BearSSL_SessionCache
+// (also after serialize/deserialize), and with tickets disabled.
+// Exit code is non-zero if any step fails.
+
+#include <ESP_SSLClient.h>
+#include "loopback/OpenSSLServer.h"
+
+// Connects twice with the same session storage and checks that only the
+// second handshake resumed.
+static bool run_session(bool tickets)
+{
+    const char *name = tickets ? "tickets" : "no tickets";
+    LoopbackClient basic_client;
+    OpenSSLServer server(basic_client);
+    ESP_SSLClient2 ssl_client(basic_client);
+
+    X509List ta(server.rootCert());
+    ssl_client.setTrustAnchors(&ta);
+    ssl_client.setX509Time(time(nullptr));
+    ssl_client.setSessionTickets(tickets);
+
+    BearSSL_Session session;
+    ssl_client.setSession(&session);
+
+    for (int round = 0; round < 2; round++)
+    {
+        if (!ssl_client.connect("localhost", 443))
+        {
+            printf("session, %s: handshake %d failed\n", name, round);
+            return false;
+        }
+
+        const uint8_t msg[] = "ping";
+        uint8_t reply[sizeof(msg)];
+        size_t got = 0;
+        ssl_client.write(msg, sizeof(msg));
+        const unsigned long start = millis();
+        while (got < sizeof(msg) && millis() - start < 5000)
+        {
+            if (ssl_client.available() > 0)
+                got += ssl_client.read(reply + got, sizeof(msg) - got);
+        }
+        ssl_client.stop();
+
+        const bool expect = tickets && round == 1;
+        if (got != sizeof(msg) || memcmp(msg, reply, sizeof(msg)) != 0 || server.resumed() != expect)
+        {
+            printf("session, %s: round %d failed (resumed %d)\n", name, round, server.resumed());
+            return false;
+        }
+    }
+
+    if (tickets != (session.getTicketLength() > 0))
+    {
+        printf("session, %s: unexpected ticket length %zu\n", name, session.getTicketLength());
+        return false;
+    }
+
+    printf("session, %-10s resumed %d, ticket %zu bytes\n", name, server.resumed(), session.getTicketLength());
+    return true;
+}
+
+static bool run_cache()
+{
+    LoopbackClient basic_client;
+    OpenSSLServer server(basic_client);
+    ESP_SSLClient2 ssl_client(basic_client);
+
+    X509List ta(server.rootCert());
+    ssl_client.setTrustAnchors(&ta);
+    ssl_client.setX509Time(time(nullptr));
+
+    BearSSL_SessionCache cache(2);
+    ssl_client.setSessionCache(&cache);
+
+    for (int round = 0; round < 2; round++)
+    {
+        if (!ssl_client.connect("localhost", 443) || server.resumed() != (round == 1))
+        {
+            printf("session cache: round %d failed\n", round);
+            return false;
+        }
+        ssl_client.stop();
+    }
+
+    std::vector<uint8_t> saved(cache.serializedSize());
+    BearSSL_SessionCache restored(2);
+    if (cache.serialize(saved.data(), saved.size()) != saved.size() || !restored.deserialize(saved.data(), saved.size()))
+    {
+        printf("session cache: serialize failed\n");
+        return false;
+    }
+
+    ssl_client.setSessionCache(&restored);
+    if (!ssl_client.connect("localhost", 443) || !server.resumed())
+    {
+        printf("session cache: restored ticket not resumed\n");
+        return false;
+    }
+    ssl_client.stop();
+
+    printf("session cache: resumed with ticket, %zu bytes serialized\n", saved.size());
+    return true;
+}
+
+int main()
+{
+    LoopbackClient probe;
+    if (!OpenSSLServer(probe).ready())
+    {
+        printf("OpenSSL server credentials failed to load\n");
+        return 1;
+    }
+
+    bool ok = run_session(true);
+    ok = run_session(false) && ok;
+    ok = run_cache() && ok;
+    return ok ? 0 : 1;
+}
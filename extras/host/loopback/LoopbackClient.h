@@ -0,0 +1,218 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Suwatchai K. <suwatchai@outlook.com>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef ESP_SSLCLIENT_HOST_LOOPBACK_CLIENT_H
+#define ESP_SSLCLIENT_HOST_LOOPBACK_CLIENT_H
+
+#include <Arduino.h>
+#include <Client.h>
+#include <vector>
+
+// One direction of the in-memory pipe.
+class LoopbackQueue
+{
+public:
+    size_t size() const { return _data.size() - _head; }
+
+    bool empty() const { return size() == 0; }
+
+    void push(const uint8_t *buf, size_t len) { _data.insert(_data.end(), buf, buf + len); }
+
+    size_t pop(uint8_t *buf, size_t len)
+    {
+        if (len > size())
+            len = size();
+        if (buf)
+            memcpy(buf, &_data[_head], len);
+        _head += len;
+        // Compact once everything queued so far was consumed.
+        if (_head == _data.size())
+        {
+            _data.clear();
+            _head = 0;
+        }
+        return len;
+    }
+
+    int peek() const { return empty() ? -1 : _data[_head]; }
+
+    void clear()
+    {
+        _data.clear();
+        _head = 0;
+    }
+
+private:
+    std::vector<uint8_t> _data;
+    size_t _head = 0;
+};
+
+// The far end of the pipe. It is pumped synchronously from the client calls,
+// so no threads are involved and every run is deterministic.
+class LoopbackPeer
+{
+public:
+    virtual ~LoopbackPeer() {}
+
+    // Called when the client opens the connection.
+    virtual void accept() {}
+
+    // Advance the peer as far as possible without blocking.
+    virtual void poll() = 0;
+};
+
+// Transport counters, used by the benchmarks to count segments and flushes.
+struct LoopbackStats
+{
+    size_t write_calls = 0;
+    size_t flush_calls = 0;
+    size_t read_calls = 0;
+    size_t bytes_out = 0;
+    size_t bytes_in = 0;
+    // TCP segments the writes would need if each write is pushed on its own
+    size_t segments = 0;
+};
+
+// Arduino Client backed by two in-memory queues instead of a socket.
+class LoopbackClient : public Client
+{
+public:
+    LoopbackClient() {}
+
+    void setPeer(LoopbackPeer *peer) { _peer = peer; }
+
+    // Queues the peer reads from and writes to.
+    LoopbackQueue &outgoing() { return _tx; }
+    LoopbackQueue &incoming() { return _rx; }
+
+    LoopbackStats &stats() { return _stats; }
+
+    void resetStats() { _stats = LoopbackStats(); }
+
+    // Maximum segment size used to estimate LoopbackStats::segments.
+    void setMss(size_t mss) { _mss = mss > 0 ? mss : 1; }
+
+    // Holds the bytes the peer sends until release(), like a network that
+    // only delivers them on a later poll.
+    void setHoldIncoming(bool hold)
+    {
+        _hold = hold;
+        _visible = _rx.size();
+    }
+
+    // Delivers everything the peer has sent so far.
+    void release() { _visible = _rx.size(); }
+
+    // Simulates the remote end closing the socket.
+    void hangup() { _connected = false; }
+
+    int connect(IPAddress ip, uint16_t port) override
+    {
+        (void)ip;
+        return mOpen(port);
+    }
+
+    int connect(const char *host, uint16_t port) override
+    {
+        (void)host;
+        return mOpen(port);
+    }
+
+    size_t write(uint8_t b) override { return write(&b, 1); }
+
+    size_t write(const uint8_t *buf, size_t size) override
+    {
+        if (!_connected)
+            return 0;
+        _stats.write_calls++;
+        _stats.bytes_out += size;
+        _stats.segments += (size + _mss - 1) / _mss;
+        _tx.push(buf, size);
+        return size;
+    }
+
+    int available() override
+    {
+        mPoll();
+        return (int)mVisible();
+    }
+
+    int read() override
+    {
+        uint8_t b;
+        return read(&b, 1) == 1 ? b : -1;
+    }
+
+    int read(uint8_t *buf, size_t size) override
+    {
+        mPoll();
+        if (mVisible() == 0)
+            return -1;
+        _stats.read_calls++;
+        size_t n = _rx.pop(buf, size < mVisible() ? size : mVisible());
+        if (_hold)
+            _visible -= n;
+        _stats.bytes_in += n;
+        return (int)n;
+    }
+
+    int peek() override
+    {
+        mPoll();
+        return mVisible() > 0 ? _rx.peek() : -1;
+    }
+
+    void flush() override
+    {
+        _stats.flush_calls++;
+        mPoll();
+    }
+
+    void stop() override
+    {
+        _connected = false;
+        _rx.clear();
+        _tx.clear();
+        _visible = 0;
+    }
+
+    uint8_t connected() override { return _connected || !_rx.empty(); }
+
+    operator bool() override { return connected(); }
+
+private:
+    int mOpen(uint16_t port)
+    {
+        _port = port;
+        _rx.clear();
+        _tx.clear();
+        _visible = 0;
+        _connected = true;
+        if (_peer)
+            _peer->accept();
+        return 1;
+    }
+
+    size_t mVisible() const { return _hold ? _visible : _rx.size(); }
+
+    void mPoll()
+    {
+        if (_peer && _connected)
+            _peer->poll();
+    }
+
+    LoopbackPeer *_peer = nullptr;
+    LoopbackQueue _tx;
+    LoopbackQueue _rx;
+    LoopbackStats _stats;
+    bool _connected = false;
+    uint16_t _port = 0;
+    size_t _mss = 1460;
+    bool _hold = false;
+    size_t _visible = 0;
+};
+
+#endif
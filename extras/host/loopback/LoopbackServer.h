@@ -0,0 +1,260 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Suwatchai K. <suwatchai@outlook.com>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef ESP_SSLCLIENT_HOST_LOOPBACK_SERVER_H
+#define ESP_SSLCLIENT_HOST_LOOPBACK_SERVER_H
+
+#include <ESP_SSLClient.h>
+#include "LoopbackClient.h"
+#include "TestCredentials.h"
+
+// Key type of the server credentials.
+enum loopback_server_key
+{
+    loopback_key_ec,
+    loopback_key_rsa
+};
+
+// BearSSL server engine living on the far end of a LoopbackClient.
+// Received application data is counted (and optionally kept or echoed),
+// queued application data is sent back to the client.
+class LoopbackServer : public LoopbackPeer
+{
+public:
+    explicit LoopbackServer(LoopbackClient &client, loopback_server_key key = loopback_key_ec) : _client(client), _key_type(key)
+    {
+        if (_key_type == loopback_key_ec)
+        {
+            _chain = new X509List(host_ec_leaf_cert);
+            _chain->append(host_ec_root_cert);
+            _sk = new PrivateKey(host_ec_leaf_key);
+        }
+        else
+        {
+            _chain = new X509List(host_rsa_leaf_cert);
+            _chain->append(host_rsa_root_cert);
+            _sk = new PrivateKey(host_rsa_leaf_key);
+        }
+        _client.setPeer(this);
+    }
+
+    ~LoopbackServer()
+    {
+        _client.setPeer(nullptr);
+        delete _chain;
+        delete _sk;
+    }
+
+    // Appends certificates (PEM) to the chain the server sends, to measure
+    // longer chains; clients that verify the chain will reject it.
+    void appendChain(const char *pem) { _chain->append(pem); }
+
+    // Root certificate (PEM) the client should trust for this server.
+    const char *rootCert() const { return _key_type == loopback_key_ec ? host_ec_root_cert : host_rsa_root_cert; }
+
+    // SHA-256 of the leaf SubjectPublicKeyInfo and of the whole leaf, for pinning.
+    const uint8_t *leafSpkiPin() const { return _key_type == loopback_key_ec ? host_ec_leaf_spki_sha256 : host_rsa_leaf_spki_sha256; }
+    const uint8_t *leafCertPin() const { return _key_type == loopback_key_ec ? host_ec_leaf_cert_sha256 : host_rsa_leaf_cert_sha256; }
+
+    // Restrict the server to the given cipher suites (nullptr restores the full list).
+    void setSuites(const uint16_t *suites, size_t count)
+    {
+        _suites = suites;
+        _suites_cnt = count;
+    }
+
+    // Restrict the ECDHE curves the server accepts to the given mask of
+    // (1 << curve id), e.g. (1 << BR_EC_secp256r1) to avoid X25519.
+    // 0 restores the default curve set.
+    void setCurves(uint32_t mask) { _curves = mask; }
+
+    // Key type of the certificate issuer (EC server only). BR_KEYTYPE_RSA
+    // enables the ECDH_RSA suites instead of ECDH_ECDSA.
+    void setIssuerKeyType(unsigned key_type) { _issuer_key_type = key_type; }
+
+    // Enables the server side session cache so clients can resume.
+    void enableSessionCache(bool enable) { _use_cache = enable; }
+
+    // Echo received application data back to the client.
+    void setEcho(bool echo) { _echo = echo; }
+
+    // Keep received application data for inspection.
+    void setKeepReceived(bool keep) { _keep = keep; }
+
+    // Queue application data for the client.
+    void send(const uint8_t *buf, size_t len) { _app_out.push(buf, len); }
+
+    const std::vector<uint8_t> &received() const { return _received; }
+
+    size_t receivedBytes() const { return _received_bytes; }
+
+    // Cipher suite of the current/last connection.
+    uint16_t cipherSuite() const { return _sc.eng.session.cipher_suite; }
+
+    // True if the current/last handshake resumed a cached session.
+    bool resumed() const { return _resumed; }
+
+    // Number of connections accepted so far.
+    size_t accepted() const { return _accepted; }
+
+    // Microseconds spent inside the server engine, so callers can subtract
+    // the server share from end-to-end timings.
+    unsigned long busyMicros() const { return _busy_us; }
+
+    void resetCounters()
+    {
+        _received.clear();
+        _received_bytes = 0;
+        _busy_us = 0;
+    }
+
+    br_ssl_engine_context *engine() { return &_sc.eng; }
+
+    void accept() override
+    {
+        const unsigned long start = micros();
+        if (_key_type == loopback_key_ec)
+            br_ssl_server_init_full_ec(&_sc, _chain->getX509Certs(), _chain->getCount(), _issuer_key_type, _sk->getEC());
+        else
+            br_ssl_server_init_full_rsa(&_sc, _chain->getX509Certs(), _chain->getCount(), _sk->getRSA());
+
+        if (_suites)
+            br_ssl_engine_set_suites(&_sc.eng, _suites, _suites_cnt);
+
+        if (_curves)
+        {
+            // The signing key is not affected, it uses its own EC implementation.
+            _ec = *_sc.eng.iec;
+            _ec.supported_curves &= _curves;
+            br_ssl_engine_set_ec(&_sc.eng, &_ec);
+        }
+
+        br_ssl_engine_set_buffer(&_sc.eng, _iobuf, sizeof(_iobuf), 1);
+
+        if (_use_cache)
+        {
+            // The cache must survive across connections, so initialize it only once.
+            if (!_cache_ready)
+            {
+                br_ssl_session_cache_lru_init(&_lru, _cache_buf, sizeof(_cache_buf));
+                _cache_ready = true;
+            }
+            br_ssl_server_set_cache(&_sc, &_lru.vtable);
+        }
+
+        uint8_t seed[32];
+        for (size_t i = 0; i < sizeof(seed); i++)
+            seed[i] = static_cast<uint8_t>(random(256));
+        br_ssl_engine_inject_entropy(&_sc.eng, seed, sizeof(seed));
+
+        br_ssl_server_reset(&_sc);
+        _app_out.clear();
+        _handshaking = true;
+        _resumed = false;
+        _accepted++;
+        _busy_us += micros() - start;
+    }
+
+    void poll() override
+    {
+        const unsigned long start = micros();
+        br_ssl_engine_context *eng = &_sc.eng;
+        for (;;)
+        {
+            unsigned state = br_ssl_engine_current_state(eng);
+            if (state & BR_SSL_CLOSED)
+                break;
+
+            if (state & BR_SSL_SENDREC)
+            {
+                size_t len;
+                unsigned char *buf = br_ssl_engine_sendrec_buf(eng, &len);
+                _client.incoming().push(buf, len);
+                br_ssl_engine_sendrec_ack(eng, len);
+                continue;
+            }
+
+            if (_handshaking && (state & BR_SSL_SENDAPP))
+            {
+                // A full handshake ends with a fresh session ID being cached,
+                // an abbreviated one reuses the ID the client offered.
+                _handshaking = false;
+                _resumed = _use_cache && _last_id_len && eng->session.session_id_len == _last_id_len &&
+                           memcmp(eng->session.session_id, _last_id, _last_id_len) == 0;
+                _last_id_len = eng->session.session_id_len;
+                memcpy(_last_id, eng->session.session_id, _last_id_len);
+            }
+
+            if (state & BR_SSL_RECVAPP)
+            {
+                size_t len;
+                unsigned char *buf = br_ssl_engine_recvapp_buf(eng, &len);
+                if (_keep)
+                    _received.insert(_received.end(), buf, buf + len);
+                if (_echo)
+                    _app_out.push(buf, len);
+                _received_bytes += len;
+                br_ssl_engine_recvapp_ack(eng, len);
+                continue;
+            }
+
+            if ((state & BR_SSL_SENDAPP) && !_app_out.empty())
+            {
+                size_t len;
+                unsigned char *buf = br_ssl_engine_sendapp_buf(eng, &len);
+                size_t n = _app_out.pop(buf, len);
+                br_ssl_engine_sendapp_ack(eng, n);
+                if (_app_out.empty())
+                    br_ssl_engine_flush(eng, 0);
+                continue;
+            }
+
+            if ((state & BR_SSL_RECVREC) && !_client.outgoing().empty())
+            {
+                size_t len;
+                unsigned char *buf = br_ssl_engine_recvrec_buf(eng, &len);
+                size_t n = _client.outgoing().pop(buf, len);
+                br_ssl_engine_recvrec_ack(eng, n);
+                continue;
+            }
+
+            break;
+        }
+        _busy_us += micros() - start;
+    }
+
+private:
+    LoopbackClient &_client;
+    loopback_server_key _key_type;
+    X509List *_chain = nullptr;
+    PrivateKey *_sk = nullptr;
+    const uint16_t *_suites = nullptr;
+    size_t _suites_cnt = 0;
+    bool _use_cache = false;
+    bool _cache_ready = false;
+    bool _echo = false;
+    bool _keep = false;
+    uint32_t _curves = 0;
+    unsigned _issuer_key_type = BR_KEYTYPE_EC;
+    bool _handshaking = false;
+    bool _resumed = false;
+    size_t _accepted = 0;
+    unsigned char _last_id[32];
+    size_t _last_id_len = 0;
+
+    br_ssl_server_context _sc;
+    br_ec_impl _ec;
+    br_ssl_session_cache_lru _lru;
+    unsigned char _cache_buf[4096];
+    unsigned char _iobuf[BR_SSL_BUFSIZE_BIDI];
+
+    LoopbackQueue _app_out;
+    std::vector<uint8_t> _received;
+    size_t _received_bytes = 0;
+    unsigned long _busy_us = 0;
+};
+
+#endif
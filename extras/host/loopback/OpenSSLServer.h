@@ -0,0 +1,134 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Suwatchai K. <suwatchai@outlook.com>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef ESP_SSLCLIENT_HOST_OPENSSL_SERVER_H
+#define ESP_SSLCLIENT_HOST_OPENSSL_SERVER_H
+
+#include <openssl/err.h>
+#include <openssl/pem.h>
+#include <openssl/ssl.h>
+
+#include "LoopbackClient.h"
+#include "TestCredentials.h"
+
+// OpenSSL TLS 1.2 server on the far end of a LoopbackClient, for the client
+// features the BearSSL server engine does not implement. It keeps no session
+// cache, so sessions can only resume with a session ticket (RFC 5077).
+// Received application data is echoed back.
+class OpenSSLServer : public LoopbackPeer
+{
+public:
+    explicit OpenSSLServer(LoopbackClient &client) : _client(client)
+    {
+        _ctx = SSL_CTX_new(TLS_server_method());
+        SSL_CTX_set_min_proto_version(_ctx, TLS1_2_VERSION);
+        SSL_CTX_set_max_proto_version(_ctx, TLS1_2_VERSION);
+        SSL_CTX_set_session_cache_mode(_ctx, SSL_SESS_CACHE_OFF);
+
+        X509 *leaf = mReadCert(host_ec_leaf_cert);
+        _ready = leaf && SSL_CTX_use_certificate(_ctx, leaf) == 1;
+        X509_free(leaf);
+
+        // The chain takes ownership of the root.
+        X509 *root = mReadCert(host_ec_root_cert);
+        _ready = _ready && root && SSL_CTX_add_extra_chain_cert(_ctx, root) == 1;
+
+        BIO *bio = BIO_new_mem_buf(host_ec_leaf_key, -1);
+        EVP_PKEY *pk = PEM_read_bio_PrivateKey(bio, nullptr, nullptr, nullptr);
+        BIO_free(bio);
+        _ready = _ready && pk && SSL_CTX_use_PrivateKey(_ctx, pk) == 1;
+        EVP_PKEY_free(pk);
+
+        _client.setPeer(this);
+    }
+
+    ~OpenSSLServer()
+    {
+        _client.setPeer(nullptr);
+        SSL_free(_ssl);
+        SSL_CTX_free(_ctx);
+    }
+
+    // False if the credentials could not be loaded.
+    bool ready() const { return _ready; }
+
+    // Root certificate (PEM) the client should trust for this server.
+    const char *rootCert() const { return host_ec_root_cert; }
+
+    // Issue session tickets (the default).
+    void setTickets(bool enable)
+    {
+        if (enable)
+            SSL_CTX_clear_options(_ctx, SSL_OP_NO_TICKET);
+        else
+            SSL_CTX_set_options(_ctx, SSL_OP_NO_TICKET);
+    }
+
+    // True if the current/last handshake resumed a session.
+    bool resumed() const { return _ssl && SSL_session_reused(_ssl) == 1; }
+
+    // Number of connections accepted so far.
+    size_t accepted() const { return _accepted; }
+
+    void accept() override
+    {
+        SSL_free(_ssl);
+        _ssl = SSL_new(_ctx);
+        _rbio = BIO_new(BIO_s_mem());
+        _wbio = BIO_new(BIO_s_mem());
+        // The SSL object owns both memory BIOs.
+        SSL_set_bio(_ssl, _rbio, _wbio);
+        SSL_set_accept_state(_ssl);
+        _accepted++;
+    }
+
+    void poll() override
+    {
+        if (!_ssl)
+            return;
+
+        uint8_t buf[4096];
+        while (!_client.outgoing().empty())
+        {
+            size_t n = _client.outgoing().pop(buf, sizeof(buf));
+            BIO_write(_rbio, buf, (int)n);
+        }
+
+        if (!SSL_is_init_finished(_ssl))
+            SSL_do_handshake(_ssl);
+
+        if (SSL_is_init_finished(_ssl))
+        {
+            int n;
+            while ((n = SSL_read(_ssl, buf, sizeof(buf))) > 0)
+                SSL_write(_ssl, buf, n);
+        }
+
+        int n;
+        while ((n = BIO_read(_wbio, buf, sizeof(buf))) > 0)
+            _client.incoming().push(buf, n);
+        ERR_clear_error();
+    }
+
+private:
+    static X509 *mReadCert(const char *pem)
+    {
+        BIO *bio = BIO_new_mem_buf(pem, -1);
+        X509 *cert = PEM_read_bio_X509(bio, nullptr, nullptr, nullptr);
+        BIO_free(bio);
+        return cert;
+    }
+
+    LoopbackClient &_client;
+    SSL_CTX *_ctx = nullptr;
+    SSL *_ssl = nullptr;
+    BIO *_rbio = nullptr;
+    BIO *_wbio = nullptr;
+    bool _ready = false;
+    size_t _accepted = 0;
+};
+
+#endif
@@ -0,0 +1,70 @@
+// Generated by ta_array, 2 trust anchors.
+// Call host_trust_anchors_load() once, then use setTrustAnchors(host_trust_anchors, host_trust_anchors_count).
+
+#pragma once
+
+static const unsigned char host_trust_anchors_0_dn[] = {
+    0x30, 0x2a, 0x31, 0x28, 0x30, 0x26, 0x06, 0x03, 0x55, 0x04, 0x03, 0x0c, 0x1f, 0x45, 0x53, 0x50,
+    0x5f, 0x53, 0x53, 0x4c, 0x43, 0x6c, 0x69, 0x65, 0x6e, 0x74, 0x20, 0x48, 0x6f, 0x73, 0x74, 0x20,
+    0x54, 0x65, 0x73, 0x74, 0x20, 0x45, 0x43, 0x20, 0x52, 0x6f, 0x6f, 0x74,
+};
+
+static const unsigned char host_trust_anchors_0_q[] = {
+    0x04, 0xec, 0x92, 0x83, 0xd4, 0x40, 0x33, 0x5f, 0xbb, 0xb9, 0x25, 0x36, 0x62, 0x1b, 0x80, 0x0b,
+    0xe5, 0xc8, 0xb1, 0x5d, 0x1e, 0x5a, 0x9c, 0xd4, 0x48, 0x43, 0x5d, 0x76, 0x52, 0xbf, 0x3c, 0xbe,
+    0xa9, 0x7c, 0xbd, 0x25, 0x14, 0x3e, 0x40, 0xe8, 0x33, 0x07, 0x79, 0x80, 0x72, 0xf7, 0xc5, 0x70,
+    0xfb, 0x96, 0xa6, 0xdb, 0x14, 0xee, 0xf1, 0xc3, 0x92, 0xfd, 0x8d, 0x6d, 0xfd, 0x3d, 0xa4, 0x8b,
+    0x46,
+};
+
+static const unsigned char host_trust_anchors_1_dn[] = {
+    0x30, 0x2b, 0x31, 0x29, 0x30, 0x27, 0x06, 0x03, 0x55, 0x04, 0x03, 0x0c, 0x20, 0x45, 0x53, 0x50,
+    0x5f, 0x53, 0x53, 0x4c, 0x43, 0x6c, 0x69, 0x65, 0x6e, 0x74, 0x20, 0x48, 0x6f, 0x73, 0x74, 0x20,
+    0x54, 0x65, 0x73, 0x74, 0x20, 0x52, 0x53, 0x41, 0x20, 0x52, 0x6f, 0x6f, 0x74,
+};
+
+static const unsigned char host_trust_anchors_1_n[] = {
+    0x8d, 0x88, 0x3e, 0xa8, 0x71, 0x2c, 0xa4, 0x0a, 0xbb, 0x1a, 0xcf, 0xec, 0x24, 0xbb, 0x70, 0x67,
+    0x5f, 0x1b, 0x14, 0xf3, 0xa2, 0x5d, 0x12, 0xb3, 0x1b, 0x51, 0xb9, 0x2f, 0x9e, 0x78, 0x0f, 0x57,
+    0x05, 0x3b, 0x12, 0xaf, 0x23, 0x0d, 0xf4, 0x3b, 0xa1, 0x9c, 0x4a, 0x58, 0x58, 0x2d, 0xd8, 0x21,
+    0xca, 0xe3, 0x91, 0xd5, 0xa2, 0xc1, 0x6c, 0xe7, 0xa7, 0x36, 0x80, 0xe1, 0xbe, 0xda, 0x83, 0x8c,
+    0xa9, 0x61, 0xbb, 0x1d, 0x8b, 0xef, 0xbb, 0x35, 0xdb, 0x24, 0x73, 0x4a, 0xf5, 0x44, 0x5d, 0x80,
+    0xb2, 0xa4, 0x98, 0x4e, 0x60, 0xd0, 0x59, 0xe5, 0x37, 0x8c, 0x94, 0x70, 0x6a, 0x84, 0xcd, 0x73,
+    0xb8, 0xb5, 0x8a, 0xde, 0xe0, 0xc6, 0x59, 0x66, 0xc9, 0x09, 0x71, 0x9f, 0x3c, 0xec, 0x3d, 0x73,
+    0xf2, 0x03, 0xc3, 0x79, 0xb8, 0xdf, 0xd4, 0x69, 0xd9, 0x68, 0x16, 0x10, 0xc6, 0x26, 0x5b, 0x37,
+    0xe2, 0x78, 0xeb, 0xfc, 0x08, 0xea, 0x59, 0xf7, 0x10, 0x16, 0xf4, 0xeb, 0xde, 0x0b, 0x9d, 0xba,
+    0x75, 0x29, 0xda, 0xfd, 0x1c, 0x00, 0x7b, 0x62, 0xc4, 0xd9, 0x9b, 0x91, 0x76, 0xc8, 0x65, 0x9b,
+    0x72, 0x34, 0x5c, 0x06, 0xca, 0xb5, 0xaa, 0xb0, 0xbf, 0xe0, 0xc7, 0xf1, 0xf7, 0x2e, 0xa2, 0xc1,
+    0x94, 0x86, 0xbc, 0x32, 0x96, 0xfa, 0xaf, 0xdd, 0x04, 0xca, 0x62, 0x47, 0x23, 0x4a, 0xd6, 0x04,
+    0x3a, 0x14, 0xb4, 0x9e, 0x69, 0x6d, 0x85, 0x91, 0x0b, 0xa6, 0x0f, 0x10, 0x98, 0x79, 0x5a, 0x9f,
+    0xee, 0x64, 0xce, 0x2f, 0x3a, 0xf5, 0x00, 0xee, 0x63, 0x10, 0x3a, 0x71, 0x0e, 0x1c, 0xfb, 0x77,
+    0x0c, 0x5c, 0x75, 0xb1, 0x88, 0x1a, 0x7e, 0xbd, 0x1c, 0x16, 0x99, 0x10, 0x31, 0x1d, 0x50, 0xa6,
+    0xd2, 0x31, 0x23, 0x6e, 0x43, 0x6c, 0x2a, 0x1c, 0xbd, 0xed, 0x68, 0x0d, 0x55, 0x25, 0x4c, 0x11,
+};
+
+static const unsigned char host_trust_anchors_1_e[] = {
+    0x01, 0x00, 0x01,
+};
+
+static const size_t host_trust_anchors_count = 2;
+
+static br_x509_trust_anchor host_trust_anchors[2];
+
+static inline void host_trust_anchors_load()
+{
+    host_trust_anchors[0].dn.data = (unsigned char *)host_trust_anchors_0_dn;
+    host_trust_anchors[0].dn.len = sizeof(host_trust_anchors_0_dn);
+    host_trust_anchors[0].flags = BR_X509_TA_CA;
+    host_trust_anchors[0].pkey.key_type = BR_KEYTYPE_EC;
+    host_trust_anchors[0].pkey.key.ec.curve = BR_EC_secp256r1;
+    host_trust_anchors[0].pkey.key.ec.q = (unsigned char *)host_trust_anchors_0_q;
+    host_trust_anchors[0].pkey.key.ec.qlen = sizeof(host_trust_anchors_0_q);
+    host_trust_anchors[1].dn.data = (unsigned char *)host_trust_anchors_1_dn;
+    host_trust_anchors[1].dn.len = sizeof(host_trust_anchors_1_dn);
+    host_trust_anchors[1].flags = BR_X509_TA_CA;
+    host_trust_anchors[1].pkey.key_type = BR_KEYTYPE_RSA;
+    host_trust_anchors[1].pkey.key.rsa.n = (unsigned char *)host_trust_anchors_1_n;
+    host_trust_anchors[1].pkey.key.rsa.nlen = sizeof(host_trust_anchors_1_n);
+    host_trust_anchors[1].pkey.key.rsa.e = (unsigned char *)host_trust_anchors_1_e;
+    host_trust_anchors[1].pkey.key.rsa.elen = sizeof(host_trust_anchors_1_e);
+}
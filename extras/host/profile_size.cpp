@@ -0,0 +1,32 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Suwatchai K. <suwatchai@outlook.com>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+// Client only program for the code size of a cipher profile: a verified
+// connect, a request and a read, with no server linked in. Built as
+// profile_size_<profile>, compare with "size profile_size_*".
+
+#include <ESP_SSLClient.h>
+#include "loopback/LoopbackClient.h"
+#include "loopback/TestCredentials.h"
+
+int main()
+{
+    LoopbackClient basic_client;
+    ESP_SSLClient2 ssl_client(basic_client);
+    X509List ta(host_ec_root_cert);
+    ssl_client.setTrustAnchors(&ta);
+    ssl_client.setX509Time(time(nullptr));
+
+    // There is no server, so this only has to link the handshake in
+    if (ssl_client.connect("localhost", 443))
+    {
+        ssl_client.print("GET / HTTP/1.1\r\nHost: localhost\r\n\r\n");
+        uint8_t buf[256];
+        ssl_client.read(buf, sizeof(buf));
+    }
+    ssl_client.stop();
+    return 0;
+}
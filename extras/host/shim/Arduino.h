@@ -0,0 +1,94 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Suwatchai K. <suwatchai@outlook.com>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+// Minimal Arduino core shim for building the library on a Linux host.
+// Only what the library and the bundled BearSSL sources touch is provided.
+// This header is also pulled in by the C sources through bssl_config.h,
+// so everything outside the __cplusplus block must stay plain C.
+
+#ifndef ESP_SSLCLIENT_HOST_ARDUINO_H
+#define ESP_SSLCLIENT_HOST_ARDUINO_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#define PROGMEM
+#define PGM_P const char *
+#define PSTR(s) (s)
+#define F(s) (s)
+
+#define pgm_read_byte(addr) (*(const uint8_t *)(addr))
+#define pgm_read_word(addr) (*(const uint16_t *)(addr))
+#define pgm_read_dword(addr) (*(const uint32_t *)(addr))
+
+#define memcpy_P memcpy
+#define memcmp_P memcmp
+#define strlen_P strlen
+#define strcmp_P strcmp
+#define strncmp_P strncmp
+#define strcpy_P strcpy
+#define strncpy_P strncpy
+#define snprintf_P snprintf
+#define sprintf_P sprintf
+
+#ifdef __cplusplus
+
+// Time added to the clock, lets the tests skip over timeouts.
+static inline unsigned long long &host_clock_skew_us()
+{
+    static unsigned long long skew = 0;
+    return skew;
+}
+
+static inline void host_clock_advance(unsigned long ms) { host_clock_skew_us() += ms * 1000ULL; }
+
+static inline unsigned long micros()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (unsigned long)(ts.tv_sec * 1000000ULL + ts.tv_nsec / 1000 + host_clock_skew_us());
+}
+
+static inline unsigned long millis() { return micros() / 1000; }
+
+static inline void delay(unsigned long ms)
+{
+    struct timespec ts;
+    ts.tv_sec = ms / 1000;
+    ts.tv_nsec = (long)(ms % 1000) * 1000000L;
+    nanosleep(&ts, nullptr);
+}
+
+static inline void yield() {}
+
+static inline long random(long howbig) { return howbig > 0 ? rand() % howbig : 0; }
+
+static inline long random(long howsmall, long howbig) { return howsmall >= howbig ? howsmall : howsmall + random(howbig - howsmall); }
+
+#include "WString.h"
+#include "Print.h"
+#include "Stream.h"
+#include "IPAddress.h"
+
+// stdout backed Serial for ENABLE_DEBUG builds
+class HostSerial : public Print
+{
+public:
+    void begin(unsigned long) {}
+    size_t write(uint8_t c) override { return fwrite(&c, 1, 1, stdout); }
+    size_t write(const uint8_t *buf, size_t size) override { return fwrite(buf, 1, size, stdout); }
+    using Print::write;
+};
+
+static HostSerial Serial;
+
+#endif
+
+#endif
@@ -0,0 +1,175 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Suwatchai K. <suwatchai@outlook.com>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef ESP_SSLCLIENT_HOST_FS_H
+#define ESP_SSLCLIENT_HOST_FS_H
+
+#include "Arduino.h"
+#include "Stream.h"
+#include <memory>
+#include <string>
+
+#define FILE_READ "r"
+#define FILE_WRITE "w"
+#define FILE_APPEND "a"
+
+enum SeekMode
+{
+    SeekSet = 0,
+    SeekCur = 1,
+    SeekEnd = 2
+};
+
+namespace fs
+{
+    // Calls made through the files of one FS, used by the benchmarks to
+    // count flash/SD accesses. Writes follow a flash cost model: appended
+    // bytes fill new blocks, while a write over existing data rewrites every
+    // block it touches (copy on write in LittleFS, SPIFFS and FAT on flash).
+    struct FSStats
+    {
+        static const size_t block_size = 4096;
+
+        size_t opens = 0;
+        size_t reads = 0;
+        size_t seeks = 0;
+        size_t bytes_read = 0;
+        size_t writes = 0;
+        size_t bytes_written = 0;
+        size_t bytes_appended = 0;
+        size_t block_rewrites = 0;
+
+        // Blocks the writes cost in the model.
+        size_t blocks_written() const { return block_rewrites + (bytes_appended + block_size - 1) / block_size; }
+    };
+
+    // ESP32 style File over a stdio stream.
+    class File : public Stream
+    {
+    public:
+        File() {}
+
+        File(FILE *f, FSStats *stats) : _f(f, fclose), _stats(stats) {}
+
+        size_t write(uint8_t b) override { return write(&b, 1); }
+
+        size_t write(const uint8_t *buf, size_t size) override
+        {
+            if (!_f)
+                return 0;
+            const size_t pos = position(), len = this->size();
+            if (pos < len)
+            {
+                const size_t end = pos + size < len ? pos + size : len;
+                _stats->block_rewrites += (end - 1) / FSStats::block_size - pos / FSStats::block_size + 1;
+            }
+            size_t n = fwrite(buf, 1, size, _f.get());
+            _stats->writes++;
+            _stats->bytes_written += n;
+            if (pos + n > len)
+                _stats->bytes_appended += pos + n - (pos > len ? pos : len);
+            return n;
+        }
+
+        int available() override
+        {
+            if (!_f)
+                return 0;
+            return (int)(size() - position());
+        }
+
+        int read() override
+        {
+            uint8_t b;
+            return read(&b, 1) == 1 ? b : -1;
+        }
+
+        size_t read(uint8_t *buf, size_t size)
+        {
+            if (!_f)
+                return 0;
+            size_t n = fread(buf, 1, size, _f.get());
+            _stats->reads++;
+            _stats->bytes_read += n;
+            return n;
+        }
+
+        int peek() override
+        {
+            if (!_f)
+                return -1;
+            int c = fgetc(_f.get());
+            if (c >= 0)
+                ungetc(c, _f.get());
+            return c;
+        }
+
+        bool seek(uint32_t pos, SeekMode mode = SeekSet)
+        {
+            if (!_f)
+                return false;
+            _stats->seeks++;
+            return fseek(_f.get(), pos, mode == SeekSet ? SEEK_SET : mode == SeekCur ? SEEK_CUR : SEEK_END) == 0;
+        }
+
+        size_t position() const { return _f ? (size_t)ftell(_f.get()) : 0; }
+
+        size_t size() const
+        {
+            if (!_f)
+                return 0;
+            long pos = ftell(_f.get());
+            fseek(_f.get(), 0, SEEK_END);
+            long len = ftell(_f.get());
+            fseek(_f.get(), pos, SEEK_SET);
+            return (size_t)len;
+        }
+
+        void close() { _f.reset(); }
+
+        operator bool() const { return (bool)_f; }
+
+    private:
+        std::shared_ptr<FILE> _f;
+        FSStats *_stats = nullptr;
+    };
+
+    // File system rooted at a host directory.
+    class FS
+    {
+    public:
+        explicit FS(const char *root) : _root(root) {}
+
+        File open(const char *path, const char *mode = FILE_READ)
+        {
+            std::string m = mode;
+            if (m.find('b') == std::string::npos)
+                m += 'b';
+            FILE *f = fopen((_root + path).c_str(), m.c_str());
+            if (!f)
+                return File();
+            _stats.opens++;
+            return File(f, &_stats);
+        }
+
+        bool remove(const char *path) { return ::remove((_root + path).c_str()) == 0; }
+
+        bool rename(const char *pathFrom, const char *pathTo) { return ::rename((_root + pathFrom).c_str(), (_root + pathTo).c_str()) == 0; }
+
+        FSStats &stats() { return _stats; }
+
+        void resetStats() { _stats = FSStats(); }
+
+    private:
+        std::string _root;
+        FSStats _stats;
+    };
+}
+
+using fs::File;
+using fs::FS;
+
+#endif
@@ -0,0 +1,36 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Suwatchai K. <suwatchai@outlook.com>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef ESP_SSLCLIENT_HOST_IPADDRESS_H
+#define ESP_SSLCLIENT_HOST_IPADDRESS_H
+
+#include <stdint.h>
+#include <string.h>
+
+class IPAddress
+{
+public:
+    IPAddress() { memset(_address, 0, sizeof(_address)); }
+
+    IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d)
+    {
+        _address[0] = a;
+        _address[1] = b;
+        _address[2] = c;
+        _address[3] = d;
+    }
+
+    uint8_t operator[](int index) const { return _address[index]; }
+
+    bool operator==(const IPAddress &rhs) const { return memcmp(_address, rhs._address, sizeof(_address)) == 0; }
+
+    bool operator!=(const IPAddress &rhs) const { return !(*this == rhs); }
+
+private:
+    uint8_t _address[4];
+};
+
+#endif
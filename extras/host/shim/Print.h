@@ -0,0 +1,70 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Suwatchai K. <suwatchai@outlook.com>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef ESP_SSLCLIENT_HOST_PRINT_H
+#define ESP_SSLCLIENT_HOST_PRINT_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+
+class Print
+{
+public:
+    virtual ~Print() {}
+
+    virtual size_t write(uint8_t) = 0;
+
+    virtual size_t write(const uint8_t *buffer, size_t size)
+    {
+        size_t n = 0;
+        while (size--)
+        {
+            if (write(*buffer++))
+                n++;
+            else
+                break;
+        }
+        return n;
+    }
+
+    size_t write(const char *str) { return str ? write(reinterpret_cast<const uint8_t *>(str), strlen(str)) : 0; }
+
+    virtual int availableForWrite() { return 0; }
+
+    virtual void flush() {}
+
+    size_t print(const char *s) { return write(s); }
+    size_t print(char c) { return write((uint8_t)c); }
+    size_t print(int v) { return printf_impl("%d", v); }
+    size_t print(unsigned int v) { return printf_impl("%u", v); }
+    size_t print(long v) { return printf_impl("%ld", v); }
+    size_t print(unsigned long v) { return printf_impl("%lu", v); }
+
+    size_t println() { return write("\r\n"); }
+    template <typename T>
+    size_t println(T v) { return print(v) + println(); }
+
+    int getWriteError() { return _write_error; }
+    void clearWriteError() { setWriteError(0); }
+
+protected:
+    void setWriteError(int err = 1) { _write_error = err; }
+
+private:
+    template <typename T>
+    size_t printf_impl(const char *fmt, T v)
+    {
+        char buf[32];
+        snprintf(buf, sizeof(buf), fmt, v);
+        return write(buf);
+    }
+
+    int _write_error = 0;
+};
+
+#endif
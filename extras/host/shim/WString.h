@@ -0,0 +1,33 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Suwatchai K. <suwatchai@outlook.com>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef ESP_SSLCLIENT_HOST_WSTRING_H
+#define ESP_SSLCLIENT_HOST_WSTRING_H
+
+#include <string>
+
+class String
+{
+public:
+    String(const char *s = "") : _str(s ? s : "") {}
+    explicit String(int v) : _str(std::to_string(v)) {}
+
+    const char *c_str() const { return _str.c_str(); }
+    unsigned int length() const { return (unsigned int)_str.length(); }
+
+    String &operator+=(const char *s)
+    {
+        _str += s;
+        return *this;
+    }
+
+    bool operator==(const char *s) const { return _str == s; }
+
+private:
+    std::string _str;
+};
+
+#endif
@@ -0,0 +1,150 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Suwatchai K. <suwatchai@outlook.com>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+// Converts a PEM certificate bundle into a C header with the subject DNs and
+// public keys of its trust anchors stored decoded, and a br_x509_trust_anchor
+// array that <name>_load() fills from them, for setTrustAnchors(array, count):
+// nothing is parsed or allocated on the device. The array is filled in code
+// because the EC member of the key union can't be initialized statically in
+// C++11. The bytes are not in PROGMEM as BearSSL reads them with byte loads.
+//
+// Usage: ta_array <bundle.pem> <out.h> [array name]
+
+#include <ESP_SSLClient.h>
+#include <string>
+
+static bool read_file(const char *path, std::string &out)
+{
+    FILE *f = fopen(path, "rb");
+    if (!f)
+        return false;
+    char buf[4096];
+    size_t n;
+    while ((n = fread(buf, 1, sizeof(buf), f)) > 0)
+        out.append(buf, n);
+    fclose(f);
+    return true;
+}
+
+static void write_bytes(FILE *f, const std::string &name, const unsigned char *data, size_t len)
+{
+    fprintf(f, "static const unsigned char %s[] = {", name.c_str());
+    for (size_t i = 0; i < len; i++)
+        fprintf(f, "%s0x%02x,", i % 16 == 0 ? "\n    " : " ", data[i]);
+    fprintf(f, "\n};\n\n");
+}
+
+static const char *curve_name(int curve)
+{
+    switch (curve)
+    {
+    case BR_EC_secp256r1:
+        return "BR_EC_secp256r1";
+    case BR_EC_secp384r1:
+        return "BR_EC_secp384r1";
+    case BR_EC_secp521r1:
+        return "BR_EC_secp521r1";
+    default:
+        return nullptr;
+    }
+}
+
+static bool write_header(FILE *f, const std::string &name, const br_x509_trust_anchor *tas, size_t count)
+{
+    const char *n = name.c_str();
+    fprintf(f, "// Generated by ta_array, %zu trust anchors.\n", count);
+    fprintf(f, "// Call %s_load() once, then use setTrustAnchors(%s, %s_count).\n\n", n, n, n);
+    fprintf(f, "#pragma once\n\n");
+
+    // key material first, the array points into it
+    for (size_t i = 0; i < count; i++)
+    {
+        const br_x509_trust_anchor &ta = tas[i];
+        const std::string prefix = name + "_" + std::to_string(i);
+        write_bytes(f, prefix + "_dn", ta.dn.data, ta.dn.len);
+        if (ta.pkey.key_type == BR_KEYTYPE_RSA)
+        {
+            write_bytes(f, prefix + "_n", ta.pkey.key.rsa.n, ta.pkey.key.rsa.nlen);
+            write_bytes(f, prefix + "_e", ta.pkey.key.rsa.e, ta.pkey.key.rsa.elen);
+        }
+        else if (ta.pkey.key_type == BR_KEYTYPE_EC && curve_name(ta.pkey.key.ec.curve))
+            write_bytes(f, prefix + "_q", ta.pkey.key.ec.q, ta.pkey.key.ec.qlen);
+        else
+            return false;
+    }
+
+    fprintf(f, "static const size_t %s_count = %zu;\n\n", n, count);
+    fprintf(f, "static br_x509_trust_anchor %s[%zu];\n\n", n, count);
+
+    // the anchors are filled in code, which lives in flash on every platform
+    fprintf(f, "static inline void %s_load()\n{\n", n);
+    for (size_t i = 0; i < count; i++)
+    {
+        const br_x509_trust_anchor &ta = tas[i];
+        const std::string prefix = name + "_" + std::to_string(i);
+        const char *p = prefix.c_str();
+        fprintf(f, "    %s[%zu].dn.data = (unsigned char *)%s_dn;\n", n, i, p);
+        fprintf(f, "    %s[%zu].dn.len = sizeof(%s_dn);\n", n, i, p);
+        fprintf(f, "    %s[%zu].flags = %s;\n", n, i, ta.flags & BR_X509_TA_CA ? "BR_X509_TA_CA" : "0");
+        if (ta.pkey.key_type == BR_KEYTYPE_RSA)
+        {
+            fprintf(f, "    %s[%zu].pkey.key_type = BR_KEYTYPE_RSA;\n", n, i);
+            fprintf(f, "    %s[%zu].pkey.key.rsa.n = (unsigned char *)%s_n;\n", n, i, p);
+            fprintf(f, "    %s[%zu].pkey.key.rsa.nlen = sizeof(%s_n);\n", n, i, p);
+            fprintf(f, "    %s[%zu].pkey.key.rsa.e = (unsigned char *)%s_e;\n", n, i, p);
+            fprintf(f, "    %s[%zu].pkey.key.rsa.elen = sizeof(%s_e);\n", n, i, p);
+        }
+        else
+        {
+            fprintf(f, "    %s[%zu].pkey.key_type = BR_KEYTYPE_EC;\n", n, i);
+            fprintf(f, "    %s[%zu].pkey.key.ec.curve = %s;\n", n, i, curve_name(ta.pkey.key.ec.curve));
+            fprintf(f, "    %s[%zu].pkey.key.ec.q = (unsigned char *)%s_q;\n", n, i, p);
+            fprintf(f, "    %s[%zu].pkey.key.ec.qlen = sizeof(%s_q);\n", n, i, p);
+        }
+    }
+    fprintf(f, "}\n");
+    return ferror(f) == 0;
+}
+
+int main(int argc, char **argv)
+{
+    if (argc < 3)
+    {
+        fprintf(stderr, "usage: %s <bundle.pem> <out.h> [array name]\n", argv[0]);
+        return 2;
+    }
+
+    std::string pem;
+    if (!read_file(argv[1], pem))
+    {
+        fprintf(stderr, "can't read %s\n", argv[1]);
+        return 1;
+    }
+
+    X509List certs;
+    if (!certs.append(reinterpret_cast<const uint8_t *>(pem.data()), pem.size()) || certs.getCount() == 0)
+    {
+        fprintf(stderr, "no certificates in %s\n", argv[1]);
+        return 1;
+    }
+
+    FILE *f = fopen(argv[2], "w");
+    if (!f)
+    {
+        fprintf(stderr, "can't write %s\n", argv[2]);
+        return 1;
+    }
+    bool ok = write_header(f, argc > 3 ? argv[3] : "trust_anchors", certs.getTrustAnchors(), certs.getCount());
+    ok = fclose(f) == 0 && ok;
+    if (!ok)
+    {
+        fprintf(stderr, "unsupported key in %s or can't write %s\n", argv[1], argv[2]);
+        return 1;
+    }
+
+    printf("%zu trust anchors (PEM %zu bytes)\n", certs.getCount(), pem.size());
+    return 0;
+}
@@ -0,0 +1,94 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Suwatchai K. <suwatchai@outlook.com>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+// Converts a PEM certificate bundle into the precompiled trust anchor bundle
+// used by BSSL_TrustAnchorBundle, as a binary file (for the filesystem) or,
+// when the output name ends with ".h", as a C header with a const array in
+// PROGMEM.
+//
+// Usage: ta_bundle <bundle.pem> <out.bin | out.h> [array name]
+
+#include <ESP_SSLClient.h>
+#include <string>
+#include <vector>
+
+static bool read_file(const char *path, std::string &out)
+{
+    FILE *f = fopen(path, "rb");
+    if (!f)
+        return false;
+    char buf[4096];
+    size_t n;
+    while ((n = fread(buf, 1, sizeof(buf), f)) > 0)
+        out.append(buf, n);
+    fclose(f);
+    return true;
+}
+
+static bool write_header(FILE *f, const char *name, const std::vector<uint8_t> &data, size_t count)
+{
+    fprintf(f, "// Generated by ta_bundle, %zu trust anchors.\n", count);
+    fprintf(f, "// Use with BSSL_TrustAnchorBundle::begin(%s, sizeof(%s)).\n\n", name, name);
+    fprintf(f, "#pragma once\n\n");
+    fprintf(f, "#include <Arduino.h>\n\n");
+    fprintf(f, "static const uint8_t %s[] PROGMEM = {", name);
+    for (size_t i = 0; i < data.size(); i++)
+        fprintf(f, "%s0x%02x,", i % 16 == 0 ? "\n    " : " ", data[i]);
+    fprintf(f, "\n};\n");
+    return ferror(f) == 0;
+}
+
+int main(int argc, char **argv)
+{
+    if (argc < 3)
+    {
+        fprintf(stderr, "usage: %s <bundle.pem> <out.bin | out.h> [array name]\n", argv[0]);
+        return 2;
+    }
+
+    std::string pem;
+    if (!read_file(argv[1], pem))
+    {
+        fprintf(stderr, "can't read %s\n", argv[1]);
+        return 1;
+    }
+
+    X509List certs;
+    if (!certs.append(reinterpret_cast<const uint8_t *>(pem.data()), pem.size()) || certs.getCount() == 0)
+    {
+        fprintf(stderr, "no certificates in %s\n", argv[1]);
+        return 1;
+    }
+
+    const br_x509_trust_anchor *tas = certs.getTrustAnchors();
+    size_t len = BSSL_TrustAnchorBundle::build(tas, certs.getCount(), nullptr, 0);
+    std::vector<uint8_t> data(len);
+    if (len == 0 || BSSL_TrustAnchorBundle::build(tas, certs.getCount(), data.data(), data.size()) != len)
+    {
+        fprintf(stderr, "unsupported key in %s\n", argv[1]);
+        return 1;
+    }
+
+    const std::string out = argv[2];
+    const bool header = out.size() > 2 && out.compare(out.size() - 2, 2, ".h") == 0;
+    FILE *f = fopen(out.c_str(), header ? "w" : "wb");
+    if (!f)
+    {
+        fprintf(stderr, "can't write %s\n", out.c_str());
+        return 1;
+    }
+    bool ok = header ? write_header(f, argc > 3 ? argv[3] : "ta_bundle", data, certs.getCount())
+                     : fwrite(data.data(), 1, data.size(), f) == data.size();
+    ok = fclose(f) == 0 && ok;
+    if (!ok)
+    {
+        fprintf(stderr, "can't write %s\n", out.c_str());
+        return 1;
+    }
+
+    printf("%zu trust anchors, %zu bytes (PEM %zu bytes)\n", certs.getCount(), len, pem.size());
+    return 0;
+}
@@ -0,0 +1,1706 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Suwatchai K. <suwatchai@outlook.com>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+// T0 compiler for the BearSSL state machines in src/bssl (*.t0).
+//
+// A C++ reimplementation of T0Comp, the C# compiler of BearSSL's T0/
+// directory, so the generated C files can be rebuilt without a .NET runtime.
+// It reads the kernel (kern.t0) and the source files, compiles the words
+// reachable from "main" and writes the C file in T0Comp's layout.
+//
+// Usage: t0comp [-g macro] [-k kern.t0] -o <out.c> -r <prefix> <file.t0>...
+//
+//   -o    output C file
+//   -r    prefix of the generated functions (e.g. br_ssl_hs_client)
+//   -k    kernel file (default: T0COMP_KERNEL)
+//   -g    wrap the output in #include "bssl_config.h" / #if defined(macro),
+//         as the copies in src/bssl are
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#ifndef T0COMP_KERNEL
+#define T0COMP_KERNEL "kern.t0"
+#endif
+
+namespace
+{
+
+struct Word;
+
+// A compile time value: an integer, a pointer into a data block (strings are
+// data blocks too) or a C expression (CX) whose value is only known to the C
+// compiler.
+struct Value
+{
+    enum Kind
+    {
+        INT,
+        PTR,
+        CX
+    } kind = INT;
+    int32_t i = 0; // INT value or PTR offset
+    int blob = -1; // PTR data block
+    int32_t cmin = 0, cmax = 0;
+    std::string expr;
+
+    static Value num(int32_t v)
+    {
+        Value r;
+        r.i = v;
+        return r;
+    }
+
+    static Value ptr(int blob, int32_t off)
+    {
+        Value r;
+        r.kind = PTR;
+        r.blob = blob;
+        r.i = off;
+        return r;
+    }
+};
+
+enum Opcode
+{
+    OP_RET,
+    OP_LIT,
+    OP_RL,
+    OP_WL,
+    OP_JMP,
+    OP_JIF,
+    OP_JIFNOT,
+    OP_CALL
+};
+
+struct Insn
+{
+    Opcode op;
+    Value lit;
+    Word *w = nullptr;
+    int n = 0; // local index or jump target (instruction index)
+};
+
+struct Word
+{
+    std::string name;
+    bool defined = false;
+    bool immediate = false;
+    bool interpreted = false;
+    std::function<void()> builtin; // compile time implementation
+    bool hasCC = false;            // native word, with its C code
+    std::string cc;
+    std::vector<Insn> code;
+    int nlocals = 0;
+};
+
+struct Blob
+{
+    std::vector<uint8_t> bytes;
+};
+
+struct Source
+{
+    std::string path;
+    std::string text;
+    size_t pos = 0;
+    int line = 1;
+};
+
+enum CFKind
+{
+    CF_FWD,
+    CF_BACK,
+    CF_CASE,
+    CF_OF,
+    CF_ENDOF
+};
+
+struct CFEntry
+{
+    CFKind kind;
+    int idx;
+};
+
+[[noreturn]] static void fail(const char *fmt, const std::string &arg = std::string())
+{
+    fprintf(stderr, "t0comp: ");
+    fprintf(stderr, fmt, arg.c_str());
+    fprintf(stderr, "\n");
+    exit(1);
+}
+
+static bool read_file(const std::string &path, std::string &out)
+{
+    FILE *f = fopen(path.c_str(), "rb");
+    if (!f)
+        return false;
+    char buf[4096];
+    size_t n;
+    while ((n = fread(buf, 1, sizeof(buf), f)) > 0)
+        out.append(buf, n);
+    fclose(f);
+    return true;
+}
+
+// Number of bytes of the signed / unsigned 7E encoding of v.
+static int len7E_signed(int64_t v)
+{
+    int n = 1;
+    while (n < 5 && (v < -(int64_t(1) << (7 * n - 1)) || v >= (int64_t(1) << (7 * n - 1))))
+        n++;
+    return n;
+}
+
+static int len7E_unsigned(uint32_t v)
+{
+    int n = 1;
+    while (n < 5 && uint64_t(v) >= (uint64_t(1) << (7 * n)))
+        n++;
+    return n;
+}
+
+static std::string hex_byte(unsigned b)
+{
+    char buf[8];
+    snprintf(buf, sizeof(buf), "0x%02X", b & 0xFF);
+    return buf;
+}
+
+static void encode7E(std::vector<std::string> &out, int64_t v, int len)
+{
+    for (int k = len - 1; k >= 0; k--)
+    {
+        unsigned b = (unsigned)(v >> (7 * k)) & 0x7F;
+        if (k > 0)
+            b |= 0x80;
+        out.push_back(hex_byte(b));
+    }
+}
+
+// Writes comma separated items, 70 columns at most after the indent tab.
+class BlobWriter
+{
+public:
+    explicit BlobWriter(std::string &out) : out(out) {}
+
+    void append(const std::string &item)
+    {
+        if (len >= 0 && len + 2 + item.size() > 70)
+        {
+            out += ",\n";
+            len = -1;
+        }
+        if (len < 0)
+        {
+            out += "\t";
+            out += item;
+            len = item.size();
+        }
+        else
+        {
+            out += ", ";
+            out += item;
+            len += 2 + item.size();
+        }
+    }
+
+private:
+    std::string &out;
+    long len = -1;
+};
+
+class Compiler
+{
+public:
+    Compiler()
+    {
+        addBuiltins();
+    }
+
+    void parseFile(const std::string &path)
+    {
+        std::unique_ptr<Source> s(new Source());
+        s->path = path;
+        if (!read_file(path, s->text))
+            fail("cannot read %s", path);
+        src = s.get();
+        std::string tok;
+        bool isString;
+        while (nextToken(tok, isString))
+            processToken(tok, isString);
+        if (cur)
+            fail("unfinished word at end of %s", path);
+        src = nullptr;
+    }
+
+    std::string generate(const std::string &prefix, const std::string &guard);
+
+private:
+    std::map<std::string, std::unique_ptr<Word>> dict;
+    std::vector<Blob> blobs;
+    int curBlock = -1;
+    std::vector<std::string> preambles, postambles;
+    Source *src = nullptr;
+
+    // word being compiled
+    Word *cur = nullptr;
+    Word *last = nullptr;
+    std::map<std::string, int> locals;
+    std::vector<CFEntry> cf;
+
+    std::vector<Value> ds;
+
+    // ---- lexer ----
+
+    int peekc()
+    {
+        return src->pos < src->text.size() ? (unsigned char)src->text[src->pos] : -1;
+    }
+
+    int getc()
+    {
+        int c = peekc();
+        if (c >= 0)
+        {
+            src->pos++;
+            if (c == '\n')
+                src->line++;
+        }
+        return c;
+    }
+
+    [[noreturn]] void error(const char *fmt, const std::string &arg = std::string())
+    {
+        if (src)
+            fprintf(stderr, "%s:%d: ", src->path.c_str(), src->line);
+        fail(fmt, arg);
+    }
+
+    static bool isWS(int c)
+    {
+        return c >= 0 && c <= 32;
+    }
+
+    void skipWS()
+    {
+        while (isWS(peekc()))
+            getc();
+    }
+
+    bool nextToken(std::string &tok, bool &isString)
+    {
+        skipWS();
+        tok.clear();
+        isString = false;
+        int c = peekc();
+        if (c < 0)
+            return false;
+        if (c == '"')
+        {
+            getc();
+            isString = true;
+            for (;;)
+            {
+                c = getc();
+                if (c < 0)
+                    error("unfinished string literal");
+                if (c == '"')
+                    break;
+                if (c == '\\')
+                    c = escape(getc());
+                tok += (char)c;
+            }
+            return true;
+        }
+        while (peekc() >= 0 && !isWS(peekc()))
+            tok += (char)getc();
+        return true;
+    }
+
+    std::string nextWord()
+    {
+        std::string tok;
+        bool isString;
+        if (!nextToken(tok, isString) || isString)
+            error("word name expected");
+        return tok;
+    }
+
+    int escape(int c)
+    {
+        switch (c)
+        {
+        case 'n':
+            return '\n';
+        case 'r':
+            return '\r';
+        case 't':
+            return '\t';
+        case 's':
+            return ' ';
+        case '\\':
+        case '"':
+        case '`':
+            return c;
+        default:
+            error("unknown escape sequence");
+        }
+    }
+
+    // Text between a '{' and its matching '}' (C code, CX expressions).
+    std::string readBraces()
+    {
+        skipWS();
+        if (getc() != '{')
+            error("'{' expected");
+        std::string s;
+        int depth = 1;
+        for (;;)
+        {
+            int c = getc();
+            if (c < 0)
+                error("unfinished {} block");
+            if (c == '{')
+                depth++;
+            else if (c == '}' && --depth == 0)
+                break;
+            s += (char)c;
+        }
+        return s;
+    }
+
+    static bool parseNumber(const std::string &tok, int32_t &v)
+    {
+        if (tok.size() >= 2 && tok[0] == '`')
+        {
+            if (tok.size() == 2)
+            {
+                v = (unsigned char)tok[1];
+                return true;
+            }
+            if (tok.size() == 3 && tok[1] == '\\')
+            {
+                switch (tok[2])
+                {
+                case 'n':
+                    v = '\n';
+                    return true;
+                case 'r':
+                    v = '\r';
+                    return true;
+                case 't':
+                    v = '\t';
+                    return true;
+                case 's':
+                    v = ' ';
+                    return true;
+                case '\\':
+                case '`':
+                    v = tok[2];
+                    return true;
+                }
+            }
+            return false;
+        }
+        size_t i = 0;
+        bool neg = false;
+        if (tok[0] == '-' || tok[0] == '+')
+        {
+            neg = tok[0] == '-';
+            i = 1;
+        }
+        int radix = 10;
+        if (tok.size() > i + 2 && tok[i] == '0' && (tok[i + 1] == 'x' || tok[i + 1] == 'X'))
+        {
+            radix = 16;
+            i += 2;
+        }
+        else if (tok.size() > i + 2 && tok[i] == '0' && (tok[i + 1] == 'b' || tok[i + 1] == 'B'))
+        {
+            radix = 2;
+            i += 2;
+        }
+        if (i >= tok.size())
+            return false;
+        uint64_t x = 0;
+        for (; i < tok.size(); i++)
+        {
+            int d;
+            char c = tok[i];
+            if (c >= '0' && c <= '9')
+                d = c - '0';
+            else if (c >= 'a' && c <= 'f')
+                d = c - 'a' + 10;
+            else if (c >= 'A' && c <= 'F')
+                d = c - 'A' + 10;
+            else
+                return false;
+            if (d >= radix)
+                return false;
+            x = x * radix + d;
+            if (x > 0xFFFFFFFFull)
+                return false;
+        }
+        v = (int32_t)(neg ? uint32_t(0) - uint32_t(x) : uint32_t(x));
+        return true;
+    }
+
+    // ---- dictionary ----
+
+    Word *lookup(const std::string &name)
+    {
+        auto it = dict.find(name);
+        return it == dict.end() ? nullptr : it->second.get();
+    }
+
+    Word *intern(const std::string &name)
+    {
+        Word *w = lookup(name);
+        if (!w)
+        {
+            w = new Word();
+            w->name = name;
+            dict[name].reset(w);
+        }
+        return w;
+    }
+
+    Word *defineBuiltin(const std::string &name, bool immediate, std::function<void()> fn)
+    {
+        Word *w = intern(name);
+        w->defined = true;
+        w->immediate = immediate;
+        w->builtin = fn;
+        return w;
+    }
+
+    Word *kernWord(const char *name)
+    {
+        Word *w = lookup(name);
+        if (!w || !w->defined)
+            error("kernel word '%s' is not defined", name);
+        return w;
+    }
+
+    // ---- data ----
+
+    int newBlob()
+    {
+        blobs.push_back(Blob());
+        return (int)blobs.size() - 1;
+    }
+
+    Value stringValue(const std::string &s)
+    {
+        int b = newBlob();
+        blobs[b].bytes.assign(s.begin(), s.end());
+        blobs[b].bytes.push_back(0);
+        return Value::ptr(b, 0);
+    }
+
+    std::string toString(const Value &v)
+    {
+        if (v.kind != Value::PTR)
+            error("string expected");
+        const std::vector<uint8_t> &b = blobs[v.blob].bytes;
+        std::string s;
+        for (size_t i = v.i; i < b.size() && b[i]; i++)
+            s += (char)b[i];
+        return s;
+    }
+
+    // ---- data stack ----
+
+    void push(const Value &v)
+    {
+        ds.push_back(v);
+    }
+
+    Value pop()
+    {
+        if (ds.empty())
+            error("stack underflow");
+        Value v = ds.back();
+        ds.pop_back();
+        return v;
+    }
+
+    int32_t popInt()
+    {
+        Value v = pop();
+        if (v.kind != Value::INT)
+            error("integer expected");
+        return v.i;
+    }
+
+    static bool truth(const Value &v)
+    {
+        return v.kind != Value::INT || v.i != 0;
+    }
+
+    // ---- compilation ----
+
+    void emit(Opcode op, int n = 0)
+    {
+        Insn in;
+        in.op = op;
+        in.n = n;
+        cur->code.push_back(in);
+    }
+
+    void emitLit(const Value &v)
+    {
+        Insn in;
+        in.op = OP_LIT;
+        in.lit = v;
+        cur->code.push_back(in);
+    }
+
+    void emitCall(Word *w)
+    {
+        Insn in;
+        in.op = OP_CALL;
+        in.w = w;
+        cur->code.push_back(in);
+    }
+
+    int here() const
+    {
+        return (int)cur->code.size();
+    }
+
+    void requireCompiling(const char *what)
+    {
+        if (!cur)
+            error("'%s' used outside of a word definition", what);
+    }
+
+    CFEntry popCF(CFKind kind, const char *what)
+    {
+        if (cf.empty() || cf.back().kind != kind)
+            error("unbalanced control structure at '%s'", what);
+        CFEntry e = cf.back();
+        cf.pop_back();
+        return e;
+    }
+
+    void startWord(const std::string &name)
+    {
+        if (cur)
+            error("nested word definition (%s)", name);
+        Word *w = intern(name);
+        if (w->defined)
+            error("word '%s' is already defined", name);
+        cur = w;
+        cur->code.clear();
+        cur->nlocals = 0;
+        locals.clear();
+        cf.clear();
+    }
+
+    void endWord()
+    {
+        if (!cf.empty())
+            error("unbalanced control structure in '%s'", cur->name);
+        // The final return is left out when nothing can reach it.
+        bool reachable = cur->code.empty();
+        if (!reachable)
+        {
+            Opcode op = cur->code.back().op;
+            reachable = op != OP_JMP && op != OP_RET;
+        }
+        for (const Insn &in : cur->code)
+        {
+            if ((in.op == OP_JMP || in.op == OP_JIF || in.op == OP_JIFNOT) && in.n == here())
+                reachable = true;
+        }
+        if (reachable)
+            emit(OP_RET);
+        cur->defined = true;
+        cur->interpreted = true;
+        last = cur;
+        cur = nullptr;
+        locals.clear();
+    }
+
+    void processToken(const std::string &tok, bool isString)
+    {
+        if (isString)
+        {
+            Value v = stringValue(tok);
+            if (cur)
+                emitLit(v);
+            else
+                push(v);
+            return;
+        }
+        if (cur)
+        {
+            auto it = locals.find(tok);
+            if (it != locals.end())
+            {
+                emit(OP_RL, it->second);
+                return;
+            }
+            if (tok.size() > 1 && tok[0] == '>')
+            {
+                it = locals.find(tok.substr(1));
+                if (it != locals.end())
+                {
+                    emit(OP_WL, it->second);
+                    return;
+                }
+            }
+        }
+        Word *w = lookup(tok);
+        if (w && w->defined)
+        {
+            if (cur && !w->immediate)
+                emitCall(w);
+            else
+                execute(w);
+            return;
+        }
+        int32_t v;
+        if (parseNumber(tok, v))
+        {
+            if (cur)
+                emitLit(Value::num(v));
+            else
+                push(Value::num(v));
+            return;
+        }
+        if (!cur)
+            error("unknown word '%s'", tok);
+        // forward reference, resolved when the word gets defined
+        emitCall(intern(tok));
+    }
+
+    void execute(Word *w)
+    {
+        if (w->builtin)
+        {
+            w->builtin();
+            return;
+        }
+        if (!w->interpreted)
+            error("word '%s' cannot run at compile time", w->name);
+        std::vector<Value> frame(w->nlocals);
+        size_t ip = 0;
+        while (ip < w->code.size())
+        {
+            const Insn &in = w->code[ip++];
+            switch (in.op)
+            {
+            case OP_RET:
+                return;
+            case OP_LIT:
+                push(in.lit);
+                break;
+            case OP_RL:
+                push(frame[in.n]);
+                break;
+            case OP_WL:
+                frame[in.n] = pop();
+                break;
+            case OP_JMP:
+                ip = in.n;
+                break;
+            case OP_JIF:
+                if (truth(pop()))
+                    ip = in.n;
+                break;
+            case OP_JIFNOT:
+                if (!truth(pop()))
+                    ip = in.n;
+                break;
+            case OP_CALL:
+                if (!in.w->defined)
+                    error("word '%s' is not defined", in.w->name);
+                execute(in.w);
+                break;
+            }
+        }
+    }
+
+    void binop(const std::function<int32_t(int32_t, int32_t)> &fn)
+    {
+        int32_t b = popInt();
+        int32_t a = popInt();
+        push(Value::num(fn(a, b)));
+    }
+
+    void addBuiltins();
+};
+
+void Compiler::addBuiltins()
+{
+    // -- definitions --
+
+    defineBuiltin(":", false, [this]() { startWord(nextWord()); });
+
+    defineBuiltin(";", true, [this]() {
+        requireCompiling(";");
+        endWord();
+    });
+
+    defineBuiltin("immediate", false, [this]() {
+        if (!last)
+            error("no word to make immediate");
+        last->immediate = true;
+    });
+
+    defineBuiltin("cc:", false, [this]() {
+        std::string name = nextWord();
+        skipWS();
+        if (peekc() == '(')
+        {
+            while (getc() != ')')
+                if (peekc() < 0)
+                    error("unfinished comment");
+        }
+        Word *w = intern(name);
+        if (w->interpreted)
+            error("word '%s' is already defined", name);
+        w->cc = readBraces();
+        w->hasCC = true;
+        w->defined = true;
+        last = w;
+    });
+
+    defineBuiltin("preamble", false, [this]() { preambles.push_back(readBraces()); });
+    defineBuiltin("postamble", false, [this]() { postambles.push_back(readBraces()); });
+
+    defineBuiltin("(", true, [this]() {
+        for (;;)
+        {
+            int c = getc();
+            if (c < 0)
+                error("unfinished comment");
+            if (c == ')')
+                break;
+        }
+    });
+
+    defineBuiltin("\\", true, [this]() {
+        for (;;)
+        {
+            int c = getc();
+            if (c < 0 || c == '\n')
+                break;
+        }
+    });
+
+    // -- control structures --
+
+    defineBuiltin("ret", true, [this]() {
+        requireCompiling("ret");
+        emit(OP_RET);
+    });
+
+    defineBuiltin("if", true, [this]() {
+        requireCompiling("if");
+        cf.push_back({CF_FWD, here()});
+        emit(OP_JIFNOT, -1);
+    });
+
+    defineBuiltin("ifnot", true, [this]() {
+        requireCompiling("ifnot");
+        cf.push_back({CF_FWD, here()});
+        emit(OP_JIF, -1);
+    });
+
+    defineBuiltin("else", true, [this]() {
+        requireCompiling("else");
+        CFEntry e = popCF(CF_FWD, "else");
+        cf.push_back({CF_FWD, here()});
+        emit(OP_JMP, -1);
+        cur->code[e.idx].n = here();
+    });
+
+    defineBuiltin("then", true, [this]() {
+        requireCompiling("then");
+        CFEntry e = popCF(CF_FWD, "then");
+        cur->code[e.idx].n = here();
+    });
+
+    defineBuiltin("begin", true, [this]() {
+        requireCompiling("begin");
+        cf.push_back({CF_BACK, here()});
+    });
+
+    defineBuiltin("again", true, [this]() {
+        requireCompiling("again");
+        emit(OP_JMP, popCF(CF_BACK, "again").idx);
+    });
+
+    defineBuiltin("until", true, [this]() {
+        requireCompiling("until");
+        emit(OP_JIFNOT, popCF(CF_BACK, "until").idx);
+    });
+
+    defineBuiltin("untilnot", true, [this]() {
+        requireCompiling("untilnot");
+        emit(OP_JIF, popCF(CF_BACK, "untilnot").idx);
+    });
+
+    defineBuiltin("while", true, [this]() {
+        requireCompiling("while");
+        CFEntry dest = popCF(CF_BACK, "while");
+        cf.push_back({CF_FWD, here()});
+        cf.push_back(dest);
+        emit(OP_JIFNOT, -1);
+    });
+
+    defineBuiltin("whilenot", true, [this]() {
+        requireCompiling("whilenot");
+        CFEntry dest = popCF(CF_BACK, "whilenot");
+        cf.push_back({CF_FWD, here()});
+        cf.push_back(dest);
+        emit(OP_JIF, -1);
+    });
+
+    defineBuiltin("repeat", true, [this]() {
+        requireCompiling("repeat");
+        emit(OP_JMP, popCF(CF_BACK, "repeat").idx);
+        cur->code[popCF(CF_FWD, "repeat").idx].n = here();
+    });
+
+    defineBuiltin("case", true, [this]() {
+        requireCompiling("case");
+        cf.push_back({CF_CASE, 0});
+    });
+
+    defineBuiltin("of", true, [this]() {
+        requireCompiling("of");
+        emitCall(kernWord("over"));
+        emitCall(kernWord("="));
+        cf.push_back({CF_OF, here()});
+        emit(OP_JIFNOT, -1);
+        emitCall(kernWord("drop"));
+    });
+
+    defineBuiltin("endof", true, [this]() {
+        requireCompiling("endof");
+        CFEntry e = popCF(CF_OF, "endof");
+        cf.push_back({CF_ENDOF, here()});
+        emit(OP_JMP, -1);
+        cur->code[e.idx].n = here();
+    });
+
+    defineBuiltin("endcase", true, [this]() {
+        requireCompiling("endcase");
+        emitCall(kernWord("drop"));
+        while (!cf.empty() && cf.back().kind == CF_ENDOF)
+        {
+            cur->code[cf.back().idx].n = here();
+            cf.pop_back();
+        }
+        popCF(CF_CASE, "endcase");
+    });
+
+    // choice / uf ... enduf / endchoice: the first clause whose condition
+    // holds runs, then control goes past endchoice.
+    defineBuiltin("choice", true, [this]() {
+        requireCompiling("choice");
+        cf.push_back({CF_CASE, 0});
+    });
+
+    defineBuiltin("uf", true, [this]() {
+        requireCompiling("uf");
+        cf.push_back({CF_OF, here()});
+        emit(OP_JIFNOT, -1);
+    });
+
+    defineBuiltin("ufnot", true, [this]() {
+        requireCompiling("ufnot");
+        cf.push_back({CF_OF, here()});
+        emit(OP_JIF, -1);
+    });
+
+    defineBuiltin("enduf", true, [this]() {
+        requireCompiling("enduf");
+        CFEntry e = popCF(CF_OF, "enduf");
+        cf.push_back({CF_ENDOF, here()});
+        emit(OP_JMP, -1);
+        cur->code[e.idx].n = here();
+    });
+
+    defineBuiltin("endchoice", true, [this]() {
+        requireCompiling("endchoice");
+        while (!cf.empty() && cf.back().kind == CF_ENDOF)
+        {
+            cur->code[cf.back().idx].n = here();
+            cf.pop_back();
+        }
+        popCF(CF_CASE, "endchoice");
+    });
+
+    // { a b ; c } declares locals: a and b are taken from the stack, c is
+    // not initialized. Slots are given from the last name to the first.
+    defineBuiltin("{", true, [this]() {
+        requireCompiling("{");
+        std::vector<std::pair<std::string, bool>> names;
+        bool initialized = true;
+        for (;;)
+        {
+            std::string tok = nextWord();
+            if (tok == "}")
+                break;
+            if (tok == ";")
+                initialized = false;
+            else
+                names.push_back(std::make_pair(tok, initialized));
+        }
+        for (size_t i = names.size(); i-- > 0;)
+        {
+            if (locals.count(names[i].first))
+                error("duplicate local '%s'", names[i].first);
+            int idx = cur->nlocals++;
+            locals[names[i].first] = idx;
+            if (names[i].second)
+                emit(OP_WL, idx);
+        }
+    });
+
+    defineBuiltin("CX", true, [this]() {
+        Value v;
+        v.kind = Value::CX;
+        if (!parseNumber(nextWord(), v.cmin) || !parseNumber(nextWord(), v.cmax))
+            error("CX: number expected");
+        std::string e = readBraces();
+        size_t a = e.find_first_not_of(" \t\r\n");
+        size_t b = e.find_last_not_of(" \t\r\n");
+        v.expr = a == std::string::npos ? std::string() : e.substr(a, b - a + 1);
+        if (cur)
+            emitLit(v);
+        else
+            push(v);
+    });
+
+    defineBuiltin("literal", true, [this]() {
+        requireCompiling("literal");
+        emitLit(pop());
+    });
+
+    defineBuiltin("postpone", true, [this]() {
+        requireCompiling("postpone");
+        std::string name = nextWord();
+        Word *w = lookup(name);
+        if (!w || !w->defined || !w->immediate)
+            error("postpone: '%s' is not an immediate word", name);
+        emitCall(w);
+    });
+
+    // -- compile time words --
+
+    defineBuiltin("next-word", false, [this]() { push(stringValue(nextWord())); });
+
+    defineBuiltin("define-word", false, [this]() {
+        popInt(); // stack effect, not checked here
+        popInt();
+        startWord(toString(pop()));
+    });
+
+    defineBuiltin("make-CX", false, [this]() {
+        Value v;
+        v.kind = Value::CX;
+        v.expr = toString(pop());
+        v.cmax = popInt();
+        v.cmin = popInt();
+        push(v);
+    });
+
+    defineBuiltin("char", false, [this]() { push(Value::num(getc())); });
+
+    defineBuiltin("decval", false, [this]() {
+        int32_t c = popInt();
+        if (c < '0' || c > '9')
+            error("decimal digit expected");
+        push(Value::num(c - '0'));
+    });
+
+    defineBuiltin("puts", false, [this]() { fputs(toString(pop()).c_str(), stderr); });
+    defineBuiltin("cr", false, []() { fputc('\n', stderr); });
+    defineBuiltin("exitvm", false, [this]() { error("compilation aborted"); });
+
+    defineBuiltin("new-data-block", false, [this]() { curBlock = newBlob(); });
+
+    defineBuiltin("define-data-word", false, [this]() {
+        std::string name = toString(pop());
+        if (curBlock < 0)
+            error("no current data block");
+        startWord(name);
+        emitLit(Value::ptr(curBlock, (int32_t)blobs[curBlock].bytes.size()));
+        endWord();
+    });
+
+    defineBuiltin("data:", false, [this]() {
+        curBlock = newBlob();
+        std::string name = nextWord();
+        startWord(name);
+        emitLit(Value::ptr(curBlock, 0));
+        endWord();
+    });
+
+    defineBuiltin("current-data", false, [this]() {
+        if (curBlock < 0)
+            error("no current data block");
+        push(Value::ptr(curBlock, (int32_t)blobs[curBlock].bytes.size()));
+    });
+
+    defineBuiltin("data-add8", false, [this]() {
+        if (curBlock < 0)
+            error("no current data block");
+        blobs[curBlock].bytes.push_back((uint8_t)popInt());
+    });
+
+    defineBuiltin("data-set8", false, [this]() {
+        Value addr = pop();
+        int32_t v = popInt();
+        if (addr.kind != Value::PTR || addr.i < 0 || (size_t)addr.i >= blobs[addr.blob].bytes.size())
+            error("data-set8: bad address");
+        blobs[addr.blob].bytes[addr.i] = (uint8_t)v;
+    });
+
+    defineBuiltin("hexb|", false, [this]() {
+        if (curBlock < 0)
+            error("no current data block");
+        int acc = -1;
+        for (;;)
+        {
+            int c = getc();
+            int d;
+            if (c < 0)
+                error("unfinished hexb|");
+            if (c == '|')
+                break;
+            if (isWS(c))
+                continue;
+            if (c >= '0' && c <= '9')
+                d = c - '0';
+            else if (c >= 'a' && c <= 'f')
+                d = c - 'a' + 10;
+            else if (c >= 'A' && c <= 'F')
+                d = c - 'A' + 10;
+            else
+                error("hexb|: invalid hex digit");
+            if (acc < 0)
+            {
+                acc = d;
+            }
+            else
+            {
+                blobs[curBlock].bytes.push_back((uint8_t)(acc * 16 + d));
+                acc = -1;
+            }
+        }
+        if (acc >= 0)
+            error("hexb|: odd number of hex digits");
+    });
+
+    // -- kernel natives that also run at compile time --
+
+    defineBuiltin("+", false, [this]() {
+        Value b = pop();
+        Value a = pop();
+        if (a.kind == Value::PTR && b.kind == Value::PTR)
+            push(stringValue(toString(a) + toString(b)));
+        else if (a.kind == Value::PTR && b.kind == Value::INT)
+            push(Value::ptr(a.blob, a.i + b.i));
+        else if (a.kind == Value::INT && b.kind == Value::INT)
+            push(Value::num((int32_t)((uint32_t)a.i + (uint32_t)b.i)));
+        else
+            error("+: bad operands");
+    });
+
+    defineBuiltin("-", false, [this]() {
+        Value b = pop();
+        Value a = pop();
+        if (a.kind == Value::PTR && b.kind == Value::PTR && a.blob == b.blob)
+            push(Value::num(a.i - b.i));
+        else if (a.kind == Value::PTR && b.kind == Value::INT)
+            push(Value::ptr(a.blob, a.i - b.i));
+        else if (a.kind == Value::INT && b.kind == Value::INT)
+            push(Value::num((int32_t)((uint32_t)a.i - (uint32_t)b.i)));
+        else
+            error("-: bad operands");
+    });
+
+    defineBuiltin("*", false, [this]() { binop([](int32_t a, int32_t b) { return (int32_t)((uint32_t)a * (uint32_t)b); }); });
+    defineBuiltin("/", false, [this]() { binop([](int32_t a, int32_t b) { return b ? a / b : 0; }); });
+    defineBuiltin("%", false, [this]() { binop([](int32_t a, int32_t b) { return b ? a % b : 0; }); });
+    defineBuiltin("and", false, [this]() { binop([](int32_t a, int32_t b) { return a & b; }); });
+    defineBuiltin("or", false, [this]() { binop([](int32_t a, int32_t b) { return a | b; }); });
+    defineBuiltin("<<", false, [this]() { binop([](int32_t a, int32_t b) { return (int32_t)((uint32_t)a << (b & 31)); }); });
+    defineBuiltin(">>", false, [this]() { binop([](int32_t a, int32_t b) { return a >> (b & 31); }); });
+    defineBuiltin("u>>", false, [this]() { binop([](int32_t a, int32_t b) { return (int32_t)((uint32_t)a >> (b & 31)); }); });
+    defineBuiltin("<", false, [this]() { binop([](int32_t a, int32_t b) { return -(int32_t)(a < b); }); });
+    defineBuiltin("<=", false, [this]() { binop([](int32_t a, int32_t b) { return -(int32_t)(a <= b); }); });
+    defineBuiltin(">", false, [this]() { binop([](int32_t a, int32_t b) { return -(int32_t)(a > b); }); });
+    defineBuiltin(">=", false, [this]() { binop([](int32_t a, int32_t b) { return -(int32_t)(a >= b); }); });
+    defineBuiltin("u<", false, [this]() { binop([](int32_t a, int32_t b) { return -(int32_t)((uint32_t)a < (uint32_t)b); }); });
+
+    defineBuiltin("=", false, [this]() {
+        Value b = pop();
+        Value a = pop();
+        bool eq = a.kind == b.kind && a.i == b.i && a.blob == b.blob;
+        push(Value::num(eq ? -1 : 0));
+    });
+
+    defineBuiltin("<>", false, [this]() {
+        Value b = pop();
+        Value a = pop();
+        bool eq = a.kind == b.kind && a.i == b.i && a.blob == b.blob;
+        push(Value::num(eq ? 0 : -1));
+    });
+
+    defineBuiltin("neg", false, [this]() { push(Value::num((int32_t)(0u - (uint32_t)popInt()))); });
+    defineBuiltin("not", false, [this]() { push(Value::num(~popInt())); });
+
+    defineBuiltin("dup", false, [this]() {
+        Value v = pop();
+        push(v);
+        push(v);
+    });
+
+    defineBuiltin("drop", false, [this]() { pop(); });
+
+    defineBuiltin("swap", false, [this]() {
+        Value b = pop();
+        Value a = pop();
+        push(b);
+        push(a);
+    });
+
+    defineBuiltin("over", false, [this]() {
+        Value b = pop();
+        Value a = pop();
+        push(a);
+        push(b);
+        push(a);
+    });
+
+    defineBuiltin("rot", false, [this]() {
+        Value c = pop();
+        Value b = pop();
+        Value a = pop();
+        push(b);
+        push(c);
+        push(a);
+    });
+
+    defineBuiltin("-rot", false, [this]() {
+        Value c = pop();
+        Value b = pop();
+        Value a = pop();
+        push(c);
+        push(a);
+        push(b);
+    });
+
+    defineBuiltin("pick", false, [this]() {
+        int32_t n = popInt();
+        if (n < 0 || (size_t)n >= ds.size())
+            error("pick: stack underflow");
+        push(ds[ds.size() - 1 - n]);
+    });
+
+    defineBuiltin("roll", false, [this]() {
+        int32_t n = popInt();
+        if (n < 0 || (size_t)n >= ds.size())
+            error("roll: stack underflow");
+        Value v = ds[ds.size() - 1 - n];
+        ds.erase(ds.end() - 1 - n);
+        push(v);
+    });
+
+    defineBuiltin("data-get8", false, [this]() {
+        Value addr = pop();
+        if (addr.kind != Value::PTR || addr.i < 0 || (size_t)addr.i >= blobs[addr.blob].bytes.size())
+            error("data-get8: bad address");
+        push(Value::num(blobs[addr.blob].bytes[addr.i]));
+    });
+}
+
+// Native word names go in a C comment.
+static std::string comment_name(const std::string &name)
+{
+    std::string s;
+    for (unsigned char c : name)
+    {
+        if (c <= 32 || c >= 127 || c == '%')
+        {
+            char buf[8];
+            snprintf(buf, sizeof(buf), "%%%02X", c);
+            s += buf;
+        }
+        else
+        {
+            s += (char)c;
+        }
+    }
+    return s;
+}
+
+static const char t0_header[] =
+R"T0(#include <stddef.h>
+#include <stdint.h>
+
+typedef struct {
+	uint32_t *dp;
+	uint32_t *rp;
+	const unsigned char *ip;
+} t0_context;
+
+static uint32_t
+t0_parse7E_unsigned(const unsigned char **p)
+{
+	uint32_t x;
+
+	x = 0;
+	for (;;) {
+		unsigned y;
+
+		y = *(*p) ++;
+		x = (x << 7) | (uint32_t)(y & 0x7F);
+		if (y < 0x80) {
+			return x;
+		}
+	}
+}
+
+static int32_t
+t0_parse7E_signed(const unsigned char **p)
+{
+	int neg;
+	uint32_t x;
+
+	neg = ((**p) >> 6) & 1;
+	x = (uint32_t)-neg;
+	for (;;) {
+		unsigned y;
+
+		y = *(*p) ++;
+		x = (x << 7) | (uint32_t)(y & 0x7F);
+		if (y < 0x80) {
+			if (neg) {
+				return -(int32_t)~x - 1;
+			} else {
+				return (int32_t)x;
+			}
+		}
+	}
+}
+
+#define T0_VBYTE(x, n)   (unsigned char)((((uint32_t)(x) >> (n)) & 0x7F) | 0x80)
+#define T0_FBYTE(x, n)   (unsigned char)(((uint32_t)(x) >> (n)) & 0x7F)
+#define T0_SBYTE(x)      (unsigned char)((((uint32_t)(x) >> 28) + 0xF8) ^ 0xF8)
+#define T0_INT1(x)       T0_FBYTE(x, 0)
+#define T0_INT2(x)       T0_VBYTE(x, 7), T0_FBYTE(x, 0)
+#define T0_INT3(x)       T0_VBYTE(x, 14), T0_VBYTE(x, 7), T0_FBYTE(x, 0)
+#define T0_INT4(x)       T0_VBYTE(x, 21), T0_VBYTE(x, 14), T0_VBYTE(x, 7), T0_FBYTE(x, 0)
+#define T0_INT5(x)       T0_SBYTE(x), T0_VBYTE(x, 21), T0_VBYTE(x, 14), T0_VBYTE(x, 7), T0_FBYTE(x, 0)
+
+/* static const unsigned char t0_datablock[]; */
+)T0";
+
+static const char t0_enter[] =
+R"T0(#define T0_ENTER(ip, rp, slot)   do { \
+		const unsigned char *t0_newip; \
+		uint32_t t0_lnum; \
+		t0_newip = &t0_codeblock[t0_caddr[(slot) - T0_INTERPRETED]]; \
+		t0_lnum = t0_parse7E_unsigned(&t0_newip); \
+		(rp) += t0_lnum; \
+		*((rp) ++) = (uint32_t)((ip) - &t0_codeblock[0]) + (t0_lnum << 16); \
+		(ip) = t0_newip; \
+	} while (0)
+
+#define T0_DEFENTRY(name, slot) \
+void \
+name(void *ctx) \
+{ \
+	t0_context *t0ctx = ctx; \
+	t0ctx->ip = &t0_codeblock[0]; \
+	T0_ENTER(t0ctx->ip, t0ctx->rp, slot); \
+}
+)T0";
+
+static const char t0_run[] =
+R"T0(	uint32_t *dp, *rp;
+	const unsigned char *ip;
+
+#define T0_LOCAL(x)    (*(rp - 2 - (x)))
+#define T0_POP()       (*-- dp)
+#define T0_POPi()      (*(int32_t *)(-- dp))
+#define T0_PEEK(x)     (*(dp - 1 - (x)))
+#define T0_PEEKi(x)    (*(int32_t *)(dp - 1 - (x)))
+#define T0_PUSH(v)     do { *dp = (v); dp ++; } while (0)
+#define T0_PUSHi(v)    do { *(int32_t *)dp = (v); dp ++; } while (0)
+#define T0_RPOP()      (*-- rp)
+#define T0_RPOPi()     (*(int32_t *)(-- rp))
+#define T0_RPUSH(v)    do { *rp = (v); rp ++; } while (0)
+#define T0_RPUSHi(v)   do { *(int32_t *)rp = (v); rp ++; } while (0)
+#define T0_ROLL(x)     do { \
+	size_t t0len = (size_t)(x); \
+	uint32_t t0tmp = *(dp - 1 - t0len); \
+	memmove(dp - t0len - 1, dp - t0len, t0len * sizeof *dp); \
+	*(dp - 1) = t0tmp; \
+} while (0)
+#define T0_SWAP()      do { \
+	uint32_t t0tmp = *(dp - 2); \
+	*(dp - 2) = *(dp - 1); \
+	*(dp - 1) = t0tmp; \
+} while (0)
+#define T0_ROT()       do { \
+	uint32_t t0tmp = *(dp - 3); \
+	*(dp - 3) = *(dp - 2); \
+	*(dp - 2) = *(dp - 1); \
+	*(dp - 1) = t0tmp; \
+} while (0)
+#define T0_NROT()       do { \
+	uint32_t t0tmp = *(dp - 1); \
+	*(dp - 1) = *(dp - 2); \
+	*(dp - 2) = *(dp - 3); \
+	*(dp - 3) = t0tmp; \
+} while (0)
+#define T0_PICK(x)      do { \
+	uint32_t t0depth = (x); \
+	T0_PUSH(T0_PEEK(t0depth)); \
+} while (0)
+#define T0_CO()         do { \
+	goto t0_exit; \
+} while (0)
+#define T0_RET()        goto t0_next
+
+	dp = ((t0_context *)t0ctx)->dp;
+	rp = ((t0_context *)t0ctx)->rp;
+	ip = ((t0_context *)t0ctx)->ip;
+	goto t0_next;
+	for (;;) {
+		uint32_t t0x;
+
+	t0_next:
+		t0x = T0_NEXT(&ip);
+		if (t0x < T0_INTERPRETED) {
+			switch (t0x) {
+				int32_t t0off;
+
+			case 0: /* ret */
+				t0x = T0_RPOP();
+				rp -= (t0x >> 16);
+				t0x &= 0xFFFF;
+				if (t0x == 0) {
+					ip = NULL;
+					goto t0_exit;
+				}
+				ip = &t0_codeblock[t0x];
+				break;
+			case 1: /* literal constant */
+				T0_PUSHi(t0_parse7E_signed(&ip));
+				break;
+			case 2: /* read local */
+				T0_PUSH(T0_LOCAL(t0_parse7E_unsigned(&ip)));
+				break;
+			case 3: /* write local */
+				T0_LOCAL(t0_parse7E_unsigned(&ip)) = T0_POP();
+				break;
+			case 4: /* jump */
+				t0off = t0_parse7E_signed(&ip);
+				ip += t0off;
+				break;
+			case 5: /* jump if */
+				t0off = t0_parse7E_signed(&ip);
+				if (T0_POP()) {
+					ip += t0off;
+				}
+				break;
+			case 6: /* jump if not */
+				t0off = t0_parse7E_signed(&ip);
+				if (!T0_POP()) {
+					ip += t0off;
+				}
+				break;
+)T0";
+
+static const char t0_tail[] =
+R"T0(			}
+
+		} else {
+			T0_ENTER(ip, rp, t0x);
+		}
+	}
+t0_exit:
+	((t0_context *)t0ctx)->dp = dp;
+	((t0_context *)t0ctx)->rp = rp;
+	((t0_context *)t0ctx)->ip = ip;
+}
+)T0";
+
+std::string Compiler::generate(const std::string &prefix, const std::string &guard)
+{
+    Word *main = lookup("main");
+    if (!main || !main->interpreted)
+        fail("no 'main' word");
+
+    // words and data blocks reachable from main
+    std::map<std::string, Word *> natives, interp;
+    std::vector<bool> blobUsed(blobs.size());
+    std::vector<Word *> todo(1, main);
+    interp[main->name] = main;
+    while (!todo.empty())
+    {
+        Word *w = todo.back();
+        todo.pop_back();
+        for (const Insn &in : w->code)
+        {
+            if (in.op == OP_LIT && in.lit.kind == Value::PTR)
+                blobUsed[in.lit.blob] = true;
+            if (in.op != OP_CALL)
+                continue;
+            Word *t = in.w;
+            if (!t->defined)
+                fail("word '%s' is not defined", t->name);
+            if (t->interpreted)
+            {
+                if (interp.insert(std::make_pair(t->name, t)).second)
+                    todo.push_back(t);
+            }
+            else if (t->hasCC)
+            {
+                natives[t->name] = t;
+            }
+            else
+            {
+                fail("word '%s' only exists at compile time", t->name);
+            }
+        }
+    }
+
+    std::map<Word *, int> slot;
+    int next = 7;
+    for (auto &kv : natives)
+        slot[kv.second] = next++;
+    int interpreted = next;
+    for (auto &kv : interp)
+        slot[kv.second] = next++;
+    if (next > 256)
+        fail("too many words");
+
+    // data: a leading zero byte, then the used blocks in creation order
+    std::vector<uint8_t> data(1, 0);
+    std::vector<int32_t> blobAddr(blobs.size(), -1);
+    for (size_t i = 0; i < blobs.size(); i++)
+    {
+        if (!blobUsed[i])
+            continue;
+        blobAddr[i] = (int32_t)data.size();
+        data.insert(data.end(), blobs[i].bytes.begin(), blobs[i].bytes.end());
+    }
+
+    // code: local count, then the instructions; jump offsets are relative
+    // to the end of the jump and use the shortest encoding
+    std::vector<std::string> code;
+    std::vector<size_t> caddr;
+    for (auto &kv : interp)
+    {
+        Word *w = kv.second;
+        caddr.push_back(code.size());
+        encode7E(code, w->nlocals, len7E_unsigned((uint32_t)w->nlocals));
+
+        size_t n = w->code.size();
+        std::vector<int> size(n, 1), jlen(n, 1), addr(n + 1, 0);
+        auto litValue = [&](const Value &v) -> int32_t {
+            return v.kind == Value::PTR ? blobAddr[v.blob] + v.i : v.i;
+        };
+        for (size_t i = 0; i < n; i++)
+        {
+            const Insn &in = w->code[i];
+            switch (in.op)
+            {
+            case OP_LIT:
+                if (in.lit.kind == Value::CX)
+                    size[i] = 1 + std::max(len7E_signed(in.lit.cmin), len7E_signed(in.lit.cmax));
+                else
+                    size[i] = 1 + len7E_signed(litValue(in.lit));
+                break;
+            case OP_RL:
+            case OP_WL:
+                size[i] = 1 + len7E_unsigned((uint32_t)in.n);
+                break;
+            case OP_JMP:
+            case OP_JIF:
+            case OP_JIFNOT:
+                size[i] = 2;
+                break;
+            default:
+                break;
+            }
+        }
+        for (bool changed = true; changed;)
+        {
+            changed = false;
+            for (size_t i = 0; i < n; i++)
+                addr[i + 1] = addr[i] + size[i];
+            for (size_t i = 0; i < n; i++)
+            {
+                const Insn &in = w->code[i];
+                if (in.op != OP_JMP && in.op != OP_JIF && in.op != OP_JIFNOT)
+                    continue;
+                int len = len7E_signed(addr[in.n] - addr[i + 1]);
+                if (len > jlen[i])
+                {
+                    jlen[i] = len;
+                    size[i] = 1 + len;
+                    changed = true;
+                }
+            }
+        }
+        for (size_t i = 0; i < n; i++)
+        {
+            const Insn &in = w->code[i];
+            switch (in.op)
+            {
+            case OP_RET:
+                code.push_back(hex_byte(0));
+                break;
+            case OP_LIT:
+                code.push_back(hex_byte(1));
+                if (in.lit.kind == Value::CX)
+                {
+                    // one item per encoded byte, so that addresses stay right
+                    code.push_back("T0_INT" + std::to_string(size[i] - 1) + "(" + in.lit.expr + ")");
+                    for (int k = 2; k < size[i]; k++)
+                        code.push_back(std::string());
+                }
+                else
+                {
+                    encode7E(code, litValue(in.lit), size[i] - 1);
+                }
+                break;
+            case OP_RL:
+            case OP_WL:
+                code.push_back(hex_byte(in.op == OP_RL ? 2 : 3));
+                encode7E(code, in.n, size[i] - 1);
+                break;
+            case OP_JMP:
+            case OP_JIF:
+            case OP_JIFNOT:
+                code.push_back(hex_byte(in.op == OP_JMP ? 4 : in.op == OP_JIF ? 5 : 6));
+                encode7E(code, addr[in.n] - addr[i + 1], jlen[i]);
+                break;
+            case OP_CALL:
+                code.push_back(hex_byte((unsigned)slot[in.w]));
+                break;
+            }
+        }
+    }
+
+    std::string out = "/* Automatically generated code; do not modify directly. */\n\n";
+    if (!guard.empty())
+        out += "\n#include \"bssl_config.h\"\n#if defined(" + guard + ")\n\n";
+    out += t0_header;
+    out += "\n\nvoid " + prefix + "_init_main(void *t0ctx);\n";
+    out += "\nvoid " + prefix + "_run(void *t0ctx);\n\n";
+    for (const std::string &p : preambles)
+        out += p + "\n\n";
+
+    out += "static const unsigned char t0_datablock[] = {\n";
+    {
+        BlobWriter bw(out);
+        for (uint8_t b : data)
+            bw.append(hex_byte(b));
+    }
+    out += "\n};\n\nstatic const unsigned char t0_codeblock[] = {\n";
+    {
+        BlobWriter bw(out);
+        for (const std::string &item : code)
+            if (!item.empty())
+                bw.append(item);
+    }
+    out += "\n};\n\nstatic const uint16_t t0_caddr[] = {\n";
+    for (size_t i = 0; i < caddr.size(); i++)
+        out += "\t" + std::to_string(caddr[i]) + (i + 1 < caddr.size() ? ",\n" : "\n");
+    out += "};\n\n#define T0_INTERPRETED   " + std::to_string(interpreted) + "\n\n";
+    out += t0_enter;
+    out += "\nT0_DEFENTRY(" + prefix + "_init_main, " + std::to_string(slot[main]) + ")\n\n";
+    out += "#define T0_NEXT(t0ipp)   (*(*(t0ipp)) ++)\n\nvoid\n" + prefix + "_run(void *t0ctx)\n{\n";
+    out += t0_run;
+    for (auto &kv : natives)
+    {
+        out += "\t\t\tcase " + std::to_string(slot[kv.second]) + ": {\n";
+        out += "\t\t\t\t/* " + comment_name(kv.first) + " */\n";
+        out += kv.second->cc + "\n\t\t\t\t}\n\t\t\t\tbreak;\n";
+    }
+    out += t0_tail;
+    for (const std::string &p : postambles)
+        out += "\n" + p + "\n";
+    if (!guard.empty())
+        out += "\n#endif";
+    return out;
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    std::string outPath, prefix, guard, kernel = T0COMP_KERNEL;
+    std::vector<std::string> files;
+    for (int i = 1; i < argc; i++)
+    {
+        std::string a = argv[i];
+        if ((a == "-o" || a == "-r" || a == "-g" || a == "-k") && i + 1 < argc)
+        {
+            std::string v = argv[++i];
+            if (a == "-o")
+                outPath = v;
+            else if (a == "-r")
+                prefix = v;
+            else if (a == "-g")
+                guard = v;
+            else
+                kernel = v;
+        }
+        else if (!a.empty() && a[0] == '-')
+        {
+            outPath.clear();
+            break;
+        }
+        else
+        {
+            files.push_back(a);
+        }
+    }
+    if (outPath.empty() || prefix.empty() || files.empty())
+    {
+        fprintf(stderr, "usage: t0comp [-g macro] [-k kern.t0] -o <out.c> -r <prefix> <file.t0>...\n");
+        return 1;
+    }
+
+    Compiler c;
+    c.parseFile(kernel);
+    for (const std::string &f : files)
+        c.parseFile(f);
+    std::string out = c.generate(prefix, guard);
+
+    FILE *f = fopen(outPath.c_str(), "wb");
+    if (!f || fwrite(out.data(), 1, out.size(), f) != out.size())
+    {
+        fprintf(stderr, "t0comp: cannot write %s\n", outPath.c_str());
+        return 1;
+    }
+    fclose(f);
+    return 0;
+}
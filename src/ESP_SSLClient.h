@@ -87,6 +87,20 @@ enum esp_ssl_client_error_types
     esp_ssl_internal_error
 };
 
+// Result of poll(), the non-blocking engine pump.
+enum esp_ssl_poll_status
+{
+    esp_ssl_poll_error = -2,
+    esp_ssl_poll_closed = -1,
+    esp_ssl_poll_ready = 0,      // connected, nothing pending; available() tells if data arrived
+    esp_ssl_poll_want_read = 1,  // waiting for data from the server (e.g. during the handshake)
+    esp_ssl_poll_want_write = 2, // records are pending that the network client could not take yet
+};
+
+// Progress of write(Stream &): bytes written so far, bytes the stream reported
+// available when the upload started, and the user argument.
+typedef void (*esp_ssl_stream_progress_cb)(size_t written, size_t total, void *arg);
+
 #if defined(ENABLE_DEBUG)
 
 static void esp_ssl_debug_print_prefix(const char *func_name, int level)
@@ -181,6 +195,8 @@ extern "C"
 #include "client/CertStore.h"
 #include "client/SSLClient.h"
 #include "client/TCPClient.h"
+#include "client/ConnectionPool.h"
+#include "client/TrustAnchorBundle.h"
 
 class ESP_SSLClient : public BSSL_TCPClient
 {
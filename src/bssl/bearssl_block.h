@@ -2492,6 +2492,39 @@ uint32_t br_chacha20_sse2_run(const void *key,
  */
 br_chacha20_run br_chacha20_sse2_get(void);
 
+/**
+ * \brief ChaCha20 implementation (AVX2 code, constant-time).
+ *
+ * This implementation computes eight blocks in parallel, and uses
+ * `br_chacha20_sse2_run()` for data shorter than eight blocks (512
+ * bytes) and for the remainder. It is available only on x86 platforms,
+ * depending on compiler support, and runs only if the CPU implements
+ * AVX2 and the OS saves the AVX registers. Use `br_chacha20_avx2_get()`
+ * to safely obtain a pointer to that function.
+ *
+ * \see br_chacha20_run
+ *
+ * \param key    secret key (32 bytes).
+ * \param iv     IV (12 bytes).
+ * \param cc     initial counter value.
+ * \param data   data to encrypt or decrypt.
+ * \param len    data length (in bytes).
+ */
+uint32_t br_chacha20_avx2_run(const void *key,
+	const void *iv, uint32_t cc, void *data, size_t len);
+
+/**
+ * \brief Obtain the `avx2` ChaCha20 implementation, if available.
+ *
+ * This function returns a pointer to `br_chacha20_avx2_run`, if
+ * that implementation was compiled in the library _and_ the AVX2
+ * opcodes are available on the currently running CPU. If either of
+ * these conditions is not met, then this function returns `0`.
+ *
+ * \return  the `avx2` ChaCha20 implementation, or `0`.
+ */
+br_chacha20_run br_chacha20_avx2_get(void);
+
 /**
  * \brief Type for a ChaCha20+Poly1305 AEAD implementation.
  *
@@ -2655,6 +2655,18 @@ struct br_ssl_client_context_ {
 	 */
 	unsigned char hash_id;
 
+	/*
+	 * Session ticket (RFC 5077): caller-provided buffer, its capacity
+	 * (0 disables the extension), the current ticket length and the
+	 * lifetime hint of the last ticket received. The "expected" flag
+	 * is set when the server announced a NewSessionTicket message.
+	 */
+	unsigned char *session_ticket;
+	uint16_t session_ticket_max;
+	uint16_t session_ticket_len;
+	uint32_t session_ticket_lifetime;
+	unsigned char session_ticket_expected;
+
 	/*
 	 * For the core certificate handlers, thus avoiding (in most
 	 * cases) the need for an externally provided policy context.
@@ -2890,6 +2902,80 @@ static inline void
 br_ssl_client_forget_session(br_ssl_client_context *cc)
 {
 	cc->eng.session.session_id_len = 0;
+	cc->session_ticket_len = 0;
+}
+
+/**
+ * \brief Marker for the session ticket support of the client.
+ */
+#define BR_SSL_CLIENT_SESSION_TICKETS   1
+
+/**
+ * \brief Enable session tickets (RFC 5077) and set the ticket buffer.
+ *
+ * When a buffer is set, the client sends the SessionTicket extension
+ * with the first `len` bytes of `buf` (an empty extension if `len` is
+ * 0, to ask for a ticket). A ticket sent by the server is written into
+ * `buf`, replacing the previous one; tickets larger than `max_len` are
+ * ignored. Since the ticket is staged in the engine pad, `max_len` is
+ * capped to 512 bytes.
+ *
+ * When a non-empty ticket is used to resume a session that has no
+ * session ID, `br_ssl_client_reset()` generates a random session ID so
+ * that the abbreviated handshake can be recognized (RFC 5077, section
+ * 3.4).
+ *
+ * The buffer must remain valid until the handshake is finished. Use a
+ * `NULL` buffer to disable session tickets (this is the default).
+ *
+ * \param cc        client context.
+ * \param buf       ticket buffer, or `NULL`.
+ * \param max_len   ticket buffer capacity (in bytes).
+ * \param len       length of the ticket currently in the buffer.
+ */
+static inline void
+br_ssl_client_set_session_ticket(br_ssl_client_context *cc,
+	unsigned char *buf, size_t max_len, size_t len)
+{
+	if (buf == NULL) {
+		max_len = 0;
+	}
+	if (max_len > sizeof cc->eng.pad) {
+		max_len = sizeof cc->eng.pad;
+	}
+	cc->session_ticket = buf;
+	cc->session_ticket_max = (uint16_t)max_len;
+	cc->session_ticket_len = (uint16_t)(len <= max_len ? len : 0);
+}
+
+/**
+ * \brief Get the length of the current session ticket.
+ *
+ * After a handshake, this is the length of the ticket sent by the
+ * server (stored in the buffer set with
+ * `br_ssl_client_set_session_ticket()`), or of the ticket that was
+ * used, if the server did not send a new one.
+ *
+ * \param cc   client context.
+ * \return  the session ticket length (0 if there is none).
+ */
+static inline size_t
+br_ssl_client_get_session_ticket_len(const br_ssl_client_context *cc)
+{
+	return cc->session_ticket_len;
+}
+
+/**
+ * \brief Get the lifetime hint (in seconds) of the last session ticket
+ * received from the server (0 if unspecified).
+ *
+ * \param cc   client context.
+ * \return  the ticket lifetime hint.
+ */
+static inline uint32_t
+br_ssl_client_get_session_ticket_lifetime(const br_ssl_client_context *cc)
+{
+	return cc->session_ticket_lifetime;
 }
 
 /**
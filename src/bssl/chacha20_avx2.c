@@ -0,0 +1,264 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Suwatchai K. <suwatchai@outlook.com>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "bssl_config.h"
+#if defined(BSSL_BUILD_INTERNAL_CORE)
+
+#define BR_ENABLE_INTRINSICS   1
+#include "inner.h"
+
+#if BR_AVX2 && BR_SSE2
+
+/*
+ * This file contains a ChaCha20 implementation that leverages AVX2
+ * opcodes to process eight blocks in parallel. The 16 state words are
+ * kept "transposed": each 256-bit register holds the same state word
+ * for eight consecutive blocks, so that a quarter round applies to the
+ * eight blocks at once without any shuffling between rounds. Data that
+ * does not fill eight blocks is handed to the SSE2 implementation.
+ */
+
+/*
+ * AVX2 support is indicated by bit 5 of EBX for CPUID leaf 7. The OS
+ * must also save the YMM registers on context switches: OSXSAVE (bit 27)
+ * and AVX (bit 28) in ECX for leaf 1, then bits 1 and 2 of XCR0.
+ */
+static int
+avx2_supported(void)
+{
+#if BR_GCC || BR_CLANG
+	unsigned eax, ebx, ecx, edx;
+	uint32_t xcr0, xcr0_hi;
+
+	if (__get_cpuid_max(0, 0) < 7) {
+		return 0;
+	}
+	if (!br_cpuid(0, 0, 0x18000000, 0)) {
+		return 0;
+	}
+
+	/*
+	 * XGETBV is emitted as raw bytes, for assemblers that do not
+	 * know the opcode.
+	 */
+	__asm__ __volatile__ (".byte 0x0f, 0x01, 0xd0"
+		: "=a" (xcr0), "=d" (xcr0_hi) : "c" (0));
+	(void)xcr0_hi;
+	if ((xcr0 & 0x06) != 0x06) {
+		return 0;
+	}
+	__cpuid_count(7, 0, eax, ebx, ecx, edx);
+	return (ebx & 0x00000020) != 0;
+#elif BR_MSC
+	int info[4];
+
+	__cpuid(info, 0);
+	if (info[0] < 7) {
+		return 0;
+	}
+	if (!br_cpuid(0, 0, 0x18000000, 0)) {
+		return 0;
+	}
+	if ((_xgetbv(0) & 0x06) != 0x06) {
+		return 0;
+	}
+	__cpuidex(info, 7, 0);
+	return ((uint32_t)info[1] & 0x00000020) != 0;
+#else
+	return 0;
+#endif
+}
+
+/* see bearssl_block.h */
+br_chacha20_run
+br_chacha20_avx2_get(void)
+{
+	if (avx2_supported()) {
+		return &br_chacha20_avx2_run;
+	} else {
+		return 0;
+	}
+}
+
+BR_TARGETS_X86_UP
+
+/*
+ * Rotations by 16 and 8 bits are byte permutations, done with a single
+ * VPSHUFB; the other two use shifts.
+ */
+#define ROL(x, n)   _mm256_or_si256( \
+	_mm256_slli_epi32(x, n), _mm256_srli_epi32(x, 32 - (n)))
+
+#define QROUND(a, b, c, d)   do { \
+		x[a] = _mm256_add_epi32(x[a], x[b]); \
+		x[d] = _mm256_shuffle_epi8( \
+			_mm256_xor_si256(x[d], x[a]), rot16); \
+		x[c] = _mm256_add_epi32(x[c], x[d]); \
+		x[b] = ROL(_mm256_xor_si256(x[b], x[c]), 12); \
+		x[a] = _mm256_add_epi32(x[a], x[b]); \
+		x[d] = _mm256_shuffle_epi8( \
+			_mm256_xor_si256(x[d], x[a]), rot8); \
+		x[c] = _mm256_add_epi32(x[c], x[d]); \
+		x[b] = ROL(_mm256_xor_si256(x[b], x[c]), 7); \
+	} while (0)
+
+/*
+ * Transpose eight state words (w[0] to w[7], one per register, for
+ * eight blocks) into 32 bytes of output for each block, and XOR them
+ * with the data at buf, buf + 64, ... buf + 448.
+ */
+BR_TARGET("avx2")
+static inline void
+xor_words(unsigned char *buf, const __m256i *w)
+{
+	__m256i a0, a1, a2, a3, a4, a5, a6, a7;
+	__m256i b0, b1, b2, b3, b4, b5, b6, b7;
+	__m256i t[8];
+	int i;
+
+	/*
+	 * Within each 128-bit lane, interleave the words; block j of
+	 * the lane ends up in bj (low lane: blocks 0 to 3, high lane:
+	 * blocks 4 to 7), words 0-3 in b0..b3 and words 4-7 in b4..b7.
+	 */
+	a0 = _mm256_unpacklo_epi32(w[0], w[1]);
+	a1 = _mm256_unpackhi_epi32(w[0], w[1]);
+	a2 = _mm256_unpacklo_epi32(w[2], w[3]);
+	a3 = _mm256_unpackhi_epi32(w[2], w[3]);
+	a4 = _mm256_unpacklo_epi32(w[4], w[5]);
+	a5 = _mm256_unpackhi_epi32(w[4], w[5]);
+	a6 = _mm256_unpacklo_epi32(w[6], w[7]);
+	a7 = _mm256_unpackhi_epi32(w[6], w[7]);
+	b0 = _mm256_unpacklo_epi64(a0, a2);
+	b1 = _mm256_unpackhi_epi64(a0, a2);
+	b2 = _mm256_unpacklo_epi64(a1, a3);
+	b3 = _mm256_unpackhi_epi64(a1, a3);
+	b4 = _mm256_unpacklo_epi64(a4, a6);
+	b5 = _mm256_unpackhi_epi64(a4, a6);
+	b6 = _mm256_unpacklo_epi64(a5, a7);
+	b7 = _mm256_unpackhi_epi64(a5, a7);
+
+	/*
+	 * Join words 0-3 and 4-7 of each block.
+	 */
+	t[0] = _mm256_permute2x128_si256(b0, b4, 0x20);
+	t[1] = _mm256_permute2x128_si256(b1, b5, 0x20);
+	t[2] = _mm256_permute2x128_si256(b2, b6, 0x20);
+	t[3] = _mm256_permute2x128_si256(b3, b7, 0x20);
+	t[4] = _mm256_permute2x128_si256(b0, b4, 0x31);
+	t[5] = _mm256_permute2x128_si256(b1, b5, 0x31);
+	t[6] = _mm256_permute2x128_si256(b2, b6, 0x31);
+	t[7] = _mm256_permute2x128_si256(b3, b7, 0x31);
+
+	for (i = 0; i < 8; i ++) {
+		__m256i d;
+
+		d = _mm256_loadu_si256((const void *)(buf + (i << 6)));
+		d = _mm256_xor_si256(d, t[i]);
+		_mm256_storeu_si256((void *)(buf + (i << 6)), d);
+	}
+}
+
+/* see bearssl_block.h */
+BR_TARGET("avx2")
+uint32_t
+br_chacha20_avx2_run(const void *key,
+	const void *iv, uint32_t cc, void *data, size_t len)
+{
+	unsigned char *buf;
+	__m256i s[16];
+	__m256i rot16, rot8, eight;
+	int i;
+
+	static const uint32_t CW[] = {
+		0x61707865, 0x3320646e, 0x79622d32, 0x6b206574
+	};
+
+	/*
+	 * Short runs (e.g. the Poly1305 key block) are not worth the
+	 * setup of the eight lanes.
+	 */
+	if (len < 512) {
+		return br_chacha20_sse2_run(key, iv, cc, data, len);
+	}
+
+	buf = data;
+	for (i = 0; i < 4; i ++) {
+		s[i] = _mm256_set1_epi32((int)CW[i]);
+	}
+	for (i = 0; i < 8; i ++) {
+		s[4 + i] = _mm256_set1_epi32((int)br_dec32le(
+			(const unsigned char *)key + (i << 2)));
+	}
+	s[12] = _mm256_add_epi32(_mm256_set1_epi32((int)cc),
+		_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+	for (i = 0; i < 3; i ++) {
+		s[13 + i] = _mm256_set1_epi32((int)br_dec32le(
+			(const unsigned char *)iv + (i << 2)));
+	}
+	rot16 = _mm256_setr_epi32(
+		0x01000302, 0x05040706, 0x09080B0A, 0x0D0C0F0E,
+		0x01000302, 0x05040706, 0x09080B0A, 0x0D0C0F0E);
+	rot8 = _mm256_setr_epi32(
+		0x02010003, 0x06050407, 0x0A09080B, 0x0E0D0C0F,
+		0x02010003, 0x06050407, 0x0A09080B, 0x0E0D0C0F);
+	eight = _mm256_set1_epi32(8);
+
+	while (len >= 512) {
+		__m256i x[16];
+
+		for (i = 0; i < 16; i ++) {
+			x[i] = s[i];
+		}
+		for (i = 0; i < 10; i ++) {
+			QROUND(0, 4,  8, 12);
+			QROUND(1, 5,  9, 13);
+			QROUND(2, 6, 10, 14);
+			QROUND(3, 7, 11, 15);
+			QROUND(0, 5, 10, 15);
+			QROUND(1, 6, 11, 12);
+			QROUND(2, 7,  8, 13);
+			QROUND(3, 4,  9, 14);
+		}
+		for (i = 0; i < 16; i ++) {
+			x[i] = _mm256_add_epi32(x[i], s[i]);
+		}
+		xor_words(buf, x);
+		xor_words(buf + 32, x + 8);
+
+		/*
+		 * The block counter wraps around modulo 2^32, as in the
+		 * other implementations.
+		 */
+		s[12] = _mm256_add_epi32(s[12], eight);
+		cc += 8;
+		buf += 512;
+		len -= 512;
+	}
+
+	if (len > 0) {
+		cc = br_chacha20_sse2_run(key, iv, cc, buf, len);
+	}
+	return cc;
+}
+
+#undef ROL
+#undef QROUND
+
+BR_TARGETS_X86_DOWN
+
+#else
+
+/* see bearssl_block.h */
+br_chacha20_run
+br_chacha20_avx2_get(void)
+{
+	return 0;
+}
+
+#endif
+
+#endif
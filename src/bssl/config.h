@@ -204,6 +204,17 @@
 #define BR_SSE2   1
  */
 
+/*
+ * When BR_AVX2 is enabled, AVX2 intrinsics will be used for some
+ * algorithm implementations that use them (e.g. chacha20_avx2). If this
+ * is not enabled explicitly, then support for AVX2 intrinsics will be
+ * automatically detected. If set explicitly to 0, then AVX2 code will
+ * not be compiled at all. The AVX2 code is only used if the running CPU
+ * supports it.
+ *
+#define BR_AVX2   1
+ */
+
 /*
  * When BR_POWER8 is enabled, the AES implementation using the POWER ISA
  * 2.07 opcodes (available on POWER8 processors and later) is compiled.
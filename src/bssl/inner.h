@@ -297,6 +297,17 @@
 #endif
 #endif
 
+/*
+ * AVX2 intrinsics are available on x86 (32-bit and 64-bit) with
+ * GCC 5.0+, Clang 3.8+ and MSC 2015+. Older GCC and Clang versions only
+ * get the SSE/AES target options in the BR_TARGETS_X86_UP region.
+ */
+#ifndef BR_AVX2
+#if (BR_i386 || BR_amd64) && (BR_GCC_5_0 || BR_CLANG_3_8 || BR_MSC_2015)
+#define BR_AVX2   1
+#endif
+#endif
+
 /*
  * RDRAND intrinsics are available on x86 (32-bit and 64-bit) with
  * GCC 4.6+, Clang 3.7+ and MSC 2012+.
@@ -56,6 +56,20 @@ br_ssl_client_reset(br_ssl_client_context *cc,
 		return 0;
 	}
 
+	/*
+	 * A session resumed with a ticket needs a session ID, which the
+	 * server echoes if it accepts the ticket (RFC 5077, section 3.4).
+	 */
+	if (cc->session_ticket_len > 0
+		&& cc->eng.session.session_id_len == 0)
+	{
+		br_hmac_drbg_generate(&cc->eng.rng,
+			cc->eng.session.session_id,
+			sizeof cc->eng.session.session_id);
+		cc->eng.session.session_id_len =
+			sizeof cc->eng.session.session_id;
+	}
+
 	/*
 	 * We always set back the "reneg" flag to 0 because we use it
 	 * to distinguish between first handshake and renegotiation.
@@ -42,7 +42,10 @@ br_ssl_engine_set_default_chapol(br_ssl_engine_context *cc)
 		&br_sslrec_in_chapol_vtable,
 		&br_sslrec_out_chapol_vtable);
 #if BR_SSE2
-	bc = br_chacha20_sse2_get();
+	bc = br_chacha20_avx2_get();
+	if (!bc) {
+		bc = br_chacha20_sse2_get();
+	}
 	if (bc) {
 		br_ssl_engine_set_chacha20(cc, bc);
 	} else {
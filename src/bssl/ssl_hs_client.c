@@ -423,7 +423,7 @@ static const unsigned char t0_codeblock[] = {
 	0x00, 0x01, 0x00, 0x0A, 0x00, 0x00, 0x01, 0x00, 0x0D, 0x00, 0x00, 0x01,
 	0x00, 0x0E, 0x00, 0x00, 0x01, 0x00, 0x0F, 0x00, 0x00, 0x01, 0x01, 0x08,
 	0x00, 0x00, 0x01, 0x01, 0x09, 0x00, 0x00, 0x01, 0x02, 0x08, 0x00, 0x00,
-	0x01, 0x02, 0x09, 0x00, 0x00, 0x25, 0x25, 0x00, 0x00, 0x01,
+	0x01, 0x02, 0x09, 0x00, 0x00, 0x26, 0x26, 0x00, 0x00, 0x01,
 	T0_INT1(BR_ERR_BAD_CCS), 0x00, 0x00, 0x01,
 	T0_INT1(BR_ERR_BAD_CIPHER_SUITE), 0x00, 0x00, 0x01,
 	T0_INT1(BR_ERR_BAD_COMPRESSION), 0x00, 0x00, 0x01,
@@ -478,268 +478,284 @@ static const unsigned char t0_codeblock[] = {
 	0x00, 0x00, 0x01,
 	T0_INT2(offsetof(br_ssl_engine_context, session) + offsetof(br_ssl_session_parameters, session_id_len)),
 	0x00, 0x00, 0x01,
-	T0_INT2(offsetof(br_ssl_engine_context, shutdown_recv)), 0x00, 0x00,
-	0x01, T0_INT2(offsetof(br_ssl_engine_context, suites_buf)), 0x00, 0x00,
-	0x01, T0_INT2(offsetof(br_ssl_engine_context, suites_num)), 0x00, 0x00,
-	0x01,
+	T0_INT2(offsetof(br_ssl_client_context, session_ticket_expected)),
+	0x00, 0x00, 0x01,
+	T0_INT2(offsetof(br_ssl_client_context, session_ticket_len)), 0x00,
+	0x00, 0x01,
+	T0_INT2(offsetof(br_ssl_client_context, session_ticket_max)), 0x00,
+	0x00, 0x01, T0_INT2(offsetof(br_ssl_engine_context, shutdown_recv)),
+	0x00, 0x00, 0x01, T0_INT2(offsetof(br_ssl_engine_context, suites_buf)),
+	0x00, 0x00, 0x01, T0_INT2(offsetof(br_ssl_engine_context, suites_num)),
+	0x00, 0x00, 0x01,
 	T0_INT2(offsetof(br_ssl_engine_context, session) + offsetof(br_ssl_session_parameters, version)),
 	0x00, 0x00, 0x01, T0_INT2(offsetof(br_ssl_engine_context, version_in)),
 	0x00, 0x00, 0x01,
 	T0_INT2(offsetof(br_ssl_engine_context, version_max)), 0x00, 0x00,
 	0x01, T0_INT2(offsetof(br_ssl_engine_context, version_min)), 0x00,
 	0x00, 0x01, T0_INT2(offsetof(br_ssl_engine_context, version_out)),
-	0x00, 0x00, 0x09, 0x26, 0x58, 0x06, 0x02, 0x68, 0x28, 0x00, 0x00, 0x06,
-	0x08, 0x2C, 0x0E, 0x05, 0x02, 0x71, 0x28, 0x04, 0x01, 0x3C, 0x00, 0x00,
-	0x01, 0x01, 0x00, 0x01, 0x03, 0x00, 0x99, 0x26, 0x5E, 0x44, 0x9D, 0x26,
-	0x05, 0x04, 0x60, 0x01, 0x00, 0x00, 0x02, 0x00, 0x0E, 0x06, 0x02, 0x9D,
-	0x00, 0x5E, 0x04, 0x6B, 0x00, 0x06, 0x02, 0x68, 0x28, 0x00, 0x00, 0x26,
-	0x89, 0x44, 0x05, 0x03, 0x01, 0x0C, 0x08, 0x44, 0x79, 0x2C, 0xAB, 0x1C,
-	0x84, 0x01, 0x0C, 0x31, 0x00, 0x00, 0x26, 0x1F, 0x01, 0x08, 0x0B, 0x44,
-	0x5C, 0x1F, 0x08, 0x00, 0x01, 0x03, 0x00, 0x77, 0x2E, 0x02, 0x00, 0x36,
-	0x17, 0x01, 0x01, 0x0B, 0x77, 0x3E, 0x29, 0x1A, 0x36, 0x06, 0x07, 0x02,
-	0x00, 0xCF, 0x03, 0x00, 0x04, 0x75, 0x01, 0x00, 0xC5, 0x02, 0x00, 0x26,
-	0x1A, 0x17, 0x06, 0x02, 0x6F, 0x28, 0xCF, 0x04, 0x76, 0x01, 0x01, 0x00,
-	0x77, 0x3E, 0x01, 0x16, 0x87, 0x3E, 0x01, 0x00, 0x8A, 0x3C, 0x34, 0xD5,
-	0x29, 0xB4, 0x06, 0x09, 0x01, 0x7F, 0xAF, 0x01, 0x7F, 0xD2, 0x04, 0x80,
-	0x53, 0xB1, 0x79, 0x2C, 0xA1, 0x01, T0_INT1(BR_KEYTYPE_SIGN), 0x17,
-	0x06, 0x01, 0xB5, 0xB8, 0x26, 0x01, 0x0D, 0x0E, 0x06, 0x07, 0x25, 0xB7,
-	0xB8, 0x01, 0x7F, 0x04, 0x02, 0x01, 0x00, 0x03, 0x00, 0x01, 0x0E, 0x0E,
-	0x05, 0x02, 0x72, 0x28, 0x06, 0x02, 0x67, 0x28, 0x33, 0x06, 0x02, 0x72,
-	0x28, 0x02, 0x00, 0x06, 0x1C, 0xD3, 0x80, 0x2E, 0x01, 0x81, 0x7F, 0x0E,
-	0x06, 0x0D, 0x25, 0x01, 0x10, 0xDE, 0x01, 0x00, 0xDD, 0x79, 0x2C, 0xAB,
-	0x24, 0x04, 0x04, 0xD6, 0x06, 0x01, 0xD4, 0x04, 0x01, 0xD6, 0x01, 0x7F,
-	0xD2, 0x01, 0x7F, 0xAF, 0x01, 0x01, 0x77, 0x3E, 0x01, 0x17, 0x87, 0x3E,
-	0x00, 0x00, 0x38, 0x38, 0x00, 0x00, 0x9A, 0x01, 0x0C, 0x11, 0x01, 0x00,
-	0x38, 0x0E, 0x06, 0x05, 0x25, 0x01,
+	0x00, 0x00, 0x09, 0x27, 0x5A, 0x06, 0x02, 0x6A, 0x29, 0x00, 0x00, 0x06,
+	0x08, 0x2D, 0x0E, 0x05, 0x02, 0x73, 0x29, 0x04, 0x01, 0x3E, 0x00, 0x00,
+	0x01, 0x01, 0x00, 0x01, 0x03, 0x00, 0x9E, 0x27, 0x60, 0x46, 0xA2, 0x27,
+	0x05, 0x04, 0x62, 0x01, 0x00, 0x00, 0x02, 0x00, 0x0E, 0x06, 0x02, 0xA2,
+	0x00, 0x60, 0x04, 0x6B, 0x00, 0x06, 0x02, 0x6A, 0x29, 0x00, 0x00, 0x27,
+	0x8B, 0x46, 0x05, 0x03, 0x01, 0x0C, 0x08, 0x46, 0x7B, 0x2D, 0xB1, 0x1C,
+	0x86, 0x01, 0x0C, 0x32, 0x00, 0x00, 0x27, 0x20, 0x01, 0x08, 0x0B, 0x46,
+	0x5E, 0x20, 0x08, 0x00, 0x01, 0x03, 0x00, 0x79, 0x2F, 0x02, 0x00, 0x37,
+	0x17, 0x01, 0x01, 0x0B, 0x79, 0x40, 0x2A, 0x1A, 0x37, 0x06, 0x07, 0x02,
+	0x00, 0xD6, 0x03, 0x00, 0x04, 0x75, 0x01, 0x00, 0xCC, 0x02, 0x00, 0x27,
+	0x1A, 0x17, 0x06, 0x02, 0x71, 0x29, 0xD6, 0x04, 0x76, 0x01, 0x01, 0x00,
+	0x79, 0x40, 0x01, 0x16, 0x89, 0x40, 0x01, 0x00, 0x8C, 0x3E, 0x01, 0x00,
+	0x91, 0x40, 0x35, 0xDC, 0x2A, 0xBB, 0x06, 0x0E, 0x91, 0x2F, 0x06, 0x01,
+	0xBA, 0x01, 0x7F, 0xB5, 0x01, 0x7F, 0xD9, 0x04, 0x80, 0x5C, 0x01, 0x00,
+	0x92, 0x3E, 0xB7, 0x7B, 0x2D, 0xA6, 0x01, T0_INT1(BR_KEYTYPE_SIGN),
+	0x17, 0x06, 0x01, 0xBC, 0xBF, 0x27, 0x01, 0x0D, 0x0E, 0x06, 0x07, 0x26,
+	0xBE, 0xBF, 0x01, 0x7F, 0x04, 0x02, 0x01, 0x00, 0x03, 0x00, 0x01, 0x0E,
+	0x0E, 0x05, 0x02, 0x74, 0x29, 0x06, 0x02, 0x69, 0x29, 0x34, 0x06, 0x02,
+	0x74, 0x29, 0x02, 0x00, 0x06, 0x1C, 0xDA, 0x82, 0x2F, 0x01, 0x81, 0x7F,
+	0x0E, 0x06, 0x0D, 0x26, 0x01, 0x10, 0xE5, 0x01, 0x00, 0xE4, 0x7B, 0x2D,
+	0xB1, 0x25, 0x04, 0x04, 0xDD, 0x06, 0x01, 0xDB, 0x04, 0x01, 0xDD, 0x01,
+	0x7F, 0xD9, 0x91, 0x2F, 0x06, 0x01, 0xBA, 0x01, 0x7F, 0xB5, 0x01, 0x01,
+	0x79, 0x40, 0x01, 0x17, 0x89, 0x40, 0x00, 0x00, 0x39, 0x39, 0x00, 0x00,
+	0x9F, 0x01, 0x0C, 0x11, 0x01, 0x00, 0x39, 0x0E, 0x06, 0x05, 0x26, 0x01,
 	T0_INT1(BR_KEYTYPE_RSA | BR_KEYTYPE_KEYX), 0x04, 0x30, 0x01, 0x01,
-	0x38, 0x0E, 0x06, 0x05, 0x25, 0x01,
+	0x39, 0x0E, 0x06, 0x05, 0x26, 0x01,
 	T0_INT1(BR_KEYTYPE_RSA | BR_KEYTYPE_SIGN), 0x04, 0x25, 0x01, 0x02,
-	0x38, 0x0E, 0x06, 0x05, 0x25, 0x01,
+	0x39, 0x0E, 0x06, 0x05, 0x26, 0x01,
 	T0_INT1(BR_KEYTYPE_EC  | BR_KEYTYPE_SIGN), 0x04, 0x1A, 0x01, 0x03,
-	0x38, 0x0E, 0x06, 0x05, 0x25, 0x01,
+	0x39, 0x0E, 0x06, 0x05, 0x26, 0x01,
 	T0_INT1(BR_KEYTYPE_EC  | BR_KEYTYPE_KEYX), 0x04, 0x0F, 0x01, 0x04,
-	0x38, 0x0E, 0x06, 0x05, 0x25, 0x01,
+	0x39, 0x0E, 0x06, 0x05, 0x26, 0x01,
 	T0_INT1(BR_KEYTYPE_EC  | BR_KEYTYPE_KEYX), 0x04, 0x04, 0x01, 0x00,
-	0x44, 0x25, 0x00, 0x00, 0x82, 0x2E, 0x01, 0x0E, 0x0E, 0x06, 0x04, 0x01,
-	0x00, 0x04, 0x02, 0x01, 0x05, 0x00, 0x00, 0x40, 0x06, 0x04, 0x01, 0x06,
-	0x04, 0x02, 0x01, 0x00, 0x00, 0x00, 0x88, 0x2E, 0x26, 0x06, 0x08, 0x01,
-	0x01, 0x09, 0x01, 0x11, 0x07, 0x04, 0x03, 0x25, 0x01, 0x05, 0x00, 0x01,
-	0x41, 0x03, 0x00, 0x25, 0x01, 0x00, 0x43, 0x06, 0x03, 0x02, 0x00, 0x08,
-	0x42, 0x06, 0x03, 0x02, 0x00, 0x08, 0x26, 0x06, 0x06, 0x01, 0x01, 0x0B,
-	0x01, 0x06, 0x08, 0x00, 0x00, 0x8B, 0x3F, 0x26, 0x06, 0x03, 0x01, 0x09,
-	0x08, 0x00, 0x01, 0x40, 0x26, 0x06, 0x1E, 0x01, 0x00, 0x03, 0x00, 0x26,
-	0x06, 0x0E, 0x26, 0x01, 0x01, 0x17, 0x02, 0x00, 0x08, 0x03, 0x00, 0x01,
-	0x01, 0x11, 0x04, 0x6F, 0x25, 0x02, 0x00, 0x01, 0x01, 0x0B, 0x01, 0x06,
-	0x08, 0x00, 0x00, 0x7F, 0x2D, 0x44, 0x11, 0x01, 0x01, 0x17, 0x35, 0x00,
-	0x00, 0x9F, 0xCE, 0x26, 0x01, 0x07, 0x17, 0x01, 0x00, 0x38, 0x0E, 0x06,
-	0x09, 0x25, 0x01, 0x10, 0x17, 0x06, 0x01, 0x9F, 0x04, 0x35, 0x01, 0x01,
-	0x38, 0x0E, 0x06, 0x2C, 0x25, 0x25, 0x01, 0x00, 0x77, 0x3E, 0xB3, 0x88,
-	0x2E, 0x01, 0x01, 0x0E, 0x01, 0x01, 0xA8, 0x37, 0x06, 0x17, 0x29, 0x1A,
-	0x36, 0x06, 0x04, 0xCE, 0x25, 0x04, 0x78, 0x01, 0x80, 0x64, 0xC5, 0x01,
-	0x01, 0x77, 0x3E, 0x01, 0x17, 0x87, 0x3E, 0x04, 0x01, 0x9F, 0x04, 0x03,
-	0x72, 0x28, 0x25, 0x04, 0xFF, 0x34, 0x01, 0x26, 0x03, 0x00, 0x09, 0x26,
-	0x58, 0x06, 0x02, 0x68, 0x28, 0x02, 0x00, 0x00, 0x00, 0x9A, 0x01, 0x0F,
-	0x17, 0x00, 0x00, 0x76, 0x2E, 0x01, 0x00, 0x38, 0x0E, 0x06, 0x10, 0x25,
-	0x26, 0x01, 0x01, 0x0D, 0x06, 0x03, 0x25, 0x01, 0x02, 0x76, 0x3E, 0x01,
-	0x00, 0x04, 0x21, 0x01, 0x01, 0x38, 0x0E, 0x06, 0x14, 0x25, 0x01, 0x00,
-	0x76, 0x3E, 0x26, 0x01, 0x80, 0x64, 0x0E, 0x06, 0x05, 0x01, 0x82, 0x00,
-	0x08, 0x28, 0x5A, 0x04, 0x07, 0x25, 0x01, 0x82, 0x00, 0x08, 0x28, 0x25,
-	0x00, 0x00, 0x01, 0x00, 0x2F, 0x06, 0x05, 0x3A, 0xAC, 0x37, 0x04, 0x78,
-	0x26, 0x06, 0x04, 0x01, 0x01, 0x8F, 0x3E, 0x00, 0x01, 0xBF, 0xAA, 0xBF,
-	0xAA, 0xC1, 0x84, 0x44, 0x26, 0x03, 0x00, 0xB6, 0x9B, 0x9B, 0x02, 0x00,
-	0x4D, 0x26, 0x58, 0x06, 0x0A, 0x01, 0x03, 0xA8, 0x06, 0x02, 0x72, 0x28,
-	0x25, 0x04, 0x03, 0x5C, 0x8A, 0x3C, 0x00, 0x00, 0x2F, 0x06, 0x0B, 0x86,
-	0x2E, 0x01, 0x14, 0x0D, 0x06, 0x02, 0x72, 0x28, 0x04, 0x11, 0xCE, 0x01,
-	0x07, 0x17, 0x26, 0x01, 0x02, 0x0D, 0x06, 0x06, 0x06, 0x02, 0x72, 0x28,
-	0x04, 0x70, 0x25, 0xC2, 0x01, 0x01, 0x0D, 0x33, 0x37, 0x06, 0x02, 0x61,
-	0x28, 0x26, 0x01, 0x01, 0xC8, 0x36, 0xB2, 0x00, 0x01, 0xB8, 0x01, 0x0B,
-	0x0E, 0x05, 0x02, 0x72, 0x28, 0x26, 0x01, 0x03, 0x0E, 0x06, 0x08, 0xC0,
-	0x06, 0x02, 0x68, 0x28, 0x44, 0x25, 0x00, 0x44, 0x57, 0xC0, 0xAA, 0x26,
-	0x06, 0x23, 0xC0, 0xAA, 0x26, 0x56, 0x26, 0x06, 0x18, 0x26, 0x01, 0x82,
-	0x00, 0x0F, 0x06, 0x05, 0x01, 0x82, 0x00, 0x04, 0x01, 0x26, 0x03, 0x00,
-	0x84, 0x02, 0x00, 0xB6, 0x02, 0x00, 0x53, 0x04, 0x65, 0x9B, 0x54, 0x04,
-	0x5A, 0x9B, 0x9B, 0x55, 0x26, 0x06, 0x02, 0x35, 0x00, 0x25, 0x2B, 0x00,
-	0x00, 0x79, 0x2C, 0xA1, 0x01, 0x7F, 0xB0, 0x26, 0x58, 0x06, 0x02, 0x35,
-	0x28, 0x26, 0x05, 0x02, 0x72, 0x28, 0x38, 0x17, 0x0D, 0x06, 0x02, 0x74,
-	0x28, 0x3B, 0x00, 0x00, 0x9C, 0xB8, 0x01, 0x14, 0x0D, 0x06, 0x02, 0x72,
-	0x28, 0x84, 0x01, 0x0C, 0x08, 0x01, 0x0C, 0xB6, 0x9B, 0x84, 0x26, 0x01,
-	0x0C, 0x08, 0x01, 0x0C, 0x30, 0x05, 0x02, 0x64, 0x28, 0x00, 0x00, 0xB9,
-	0x06, 0x02, 0x72, 0x28, 0x06, 0x02, 0x66, 0x28, 0x00, 0x0A, 0xB8, 0x01,
-	0x02, 0x0E, 0x05, 0x02, 0x72, 0x28, 0xBF, 0x03, 0x00, 0x02, 0x00, 0x95,
-	0x2C, 0x0A, 0x02, 0x00, 0x94, 0x2C, 0x0F, 0x37, 0x06, 0x02, 0x73, 0x28,
-	0x02, 0x00, 0x93, 0x2C, 0x0D, 0x06, 0x02, 0x6B, 0x28, 0x02, 0x00, 0x96,
-	0x3C, 0x8C, 0x01, 0x20, 0xB6, 0x01, 0x00, 0x03, 0x01, 0xC1, 0x03, 0x02,
-	0x02, 0x02, 0x01, 0x20, 0x0F, 0x06, 0x02, 0x70, 0x28, 0x84, 0x02, 0x02,
-	0xB6, 0x02, 0x02, 0x8E, 0x2E, 0x0E, 0x02, 0x02, 0x01, 0x00, 0x0F, 0x17,
-	0x06, 0x0B, 0x8D, 0x84, 0x02, 0x02, 0x30, 0x06, 0x04, 0x01, 0x7F, 0x03,
-	0x01, 0x8D, 0x84, 0x02, 0x02, 0x31, 0x02, 0x02, 0x8E, 0x3E, 0x02, 0x00,
-	0x92, 0x02, 0x01, 0x98, 0xBF, 0x26, 0xC3, 0x58, 0x06, 0x02, 0x62, 0x28,
-	0x26, 0xCD, 0x02, 0x00, 0x01, 0x86, 0x03, 0x0A, 0x17, 0x06, 0x02, 0x62,
-	0x28, 0x79, 0x02, 0x01, 0x98, 0xC1, 0x06, 0x02, 0x63, 0x28, 0x26, 0x06,
-	0x81, 0x47, 0xBF, 0xAA, 0xA6, 0x03, 0x03, 0xA4, 0x03, 0x04, 0xA2, 0x03,
-	0x05, 0xA5, 0x03, 0x06, 0xA7, 0x03, 0x07, 0xA3, 0x03, 0x08, 0x27, 0x03,
-	0x09, 0x26, 0x06, 0x81, 0x18, 0xBF, 0x01, 0x00, 0x38, 0x0E, 0x06, 0x0F,
-	0x25, 0x02, 0x03, 0x05, 0x02, 0x6C, 0x28, 0x01, 0x00, 0x03, 0x03, 0xBE,
-	0x04, 0x80, 0x7F, 0x01, 0x01, 0x38, 0x0E, 0x06, 0x0F, 0x25, 0x02, 0x05,
-	0x05, 0x02, 0x6C, 0x28, 0x01, 0x00, 0x03, 0x05, 0xBC, 0x04, 0x80, 0x6A,
-	0x01, 0x83, 0xFE, 0x01, 0x38, 0x0E, 0x06, 0x0F, 0x25, 0x02, 0x04, 0x05,
-	0x02, 0x6C, 0x28, 0x01, 0x00, 0x03, 0x04, 0xBD, 0x04, 0x80, 0x53, 0x01,
-	0x0D, 0x38, 0x0E, 0x06, 0x0E, 0x25, 0x02, 0x06, 0x05, 0x02, 0x6C, 0x28,
-	0x01, 0x00, 0x03, 0x06, 0xBA, 0x04, 0x3F, 0x01, 0x0A, 0x38, 0x0E, 0x06,
-	0x0E, 0x25, 0x02, 0x07, 0x05, 0x02, 0x6C, 0x28, 0x01, 0x00, 0x03, 0x07,
-	0xBA, 0x04, 0x2B, 0x01, 0x0B, 0x38, 0x0E, 0x06, 0x0E, 0x25, 0x02, 0x08,
-	0x05, 0x02, 0x6C, 0x28, 0x01, 0x00, 0x03, 0x08, 0xBA, 0x04, 0x17, 0x01,
-	0x10, 0x38, 0x0E, 0x06, 0x0E, 0x25, 0x02, 0x09, 0x05, 0x02, 0x6C, 0x28,
-	0x01, 0x00, 0x03, 0x09, 0xAE, 0x04, 0x03, 0x6C, 0x28, 0x25, 0x04, 0xFE,
-	0x64, 0x02, 0x04, 0x06, 0x0D, 0x02, 0x04, 0x01, 0x05, 0x0F, 0x06, 0x02,
-	0x69, 0x28, 0x01, 0x01, 0x88, 0x3E, 0x9B, 0x04, 0x0C, 0xA4, 0x01, 0x05,
-	0x0F, 0x06, 0x02, 0x69, 0x28, 0x01, 0x01, 0x88, 0x3E, 0x9B, 0x02, 0x01,
-	0x00, 0x04, 0xB8, 0x01, 0x0C, 0x0E, 0x05, 0x02, 0x72, 0x28, 0xC1, 0x01,
-	0x03, 0x0E, 0x05, 0x02, 0x6D, 0x28, 0xBF, 0x26, 0x7C, 0x3E, 0x26, 0x01,
-	0x20, 0x10, 0x06, 0x02, 0x6D, 0x28, 0x40, 0x44, 0x11, 0x01, 0x01, 0x17,
-	0x05, 0x02, 0x6D, 0x28, 0xC1, 0x26, 0x01, 0x81, 0x05, 0x0F, 0x06, 0x02,
-	0x6D, 0x28, 0x26, 0x7E, 0x3E, 0x7D, 0x44, 0xB6, 0x92, 0x2C, 0x01, 0x86,
-	0x03, 0x10, 0x03, 0x00, 0x79, 0x2C, 0xCB, 0x03, 0x01, 0x01, 0x02, 0x03,
-	0x02, 0x02, 0x00, 0x06, 0x21, 0xC1, 0x26, 0x26, 0x01, 0x02, 0x0A, 0x44,
-	0x01, 0x06, 0x0F, 0x37, 0x06, 0x02, 0x6D, 0x28, 0x03, 0x02, 0xC1, 0x02,
-	0x01, 0x01, 0x01, 0x0B, 0x01, 0x03, 0x08, 0x0E, 0x05, 0x02, 0x6D, 0x28,
-	0x04, 0x08, 0x02, 0x01, 0x06, 0x04, 0x01, 0x00, 0x03, 0x02, 0xBF, 0x26,
-	0x03, 0x03, 0x26, 0x01, 0x84, 0x00, 0x0F, 0x06, 0x02, 0x6E, 0x28, 0x84,
-	0x44, 0xB6, 0x02, 0x02, 0x02, 0x01, 0x02, 0x03, 0x50, 0x26, 0x06, 0x01,
-	0x28, 0x25, 0x9B, 0x00, 0x02, 0x03, 0x00, 0x03, 0x01, 0x02, 0x00, 0x97,
-	0x02, 0x01, 0x02, 0x00, 0x39, 0x26, 0x01, 0x00, 0x0E, 0x06, 0x02, 0x60,
-	0x00, 0xD0, 0x04, 0x74, 0x02, 0x01, 0x00, 0x03, 0x00, 0xC1, 0xAA, 0x26,
-	0x06, 0x80, 0x43, 0xC1, 0x01, 0x01, 0x38, 0x0E, 0x06, 0x06, 0x25, 0x01,
-	0x81, 0x7F, 0x04, 0x2E, 0x01, 0x80, 0x40, 0x38, 0x0E, 0x06, 0x07, 0x25,
-	0x01, 0x83, 0xFE, 0x00, 0x04, 0x20, 0x01, 0x80, 0x41, 0x38, 0x0E, 0x06,
-	0x07, 0x25, 0x01, 0x84, 0x80, 0x00, 0x04, 0x12, 0x01, 0x80, 0x42, 0x38,
-	0x0E, 0x06, 0x07, 0x25, 0x01, 0x88, 0x80, 0x00, 0x04, 0x04, 0x01, 0x00,
-	0x44, 0x25, 0x02, 0x00, 0x37, 0x03, 0x00, 0x04, 0xFF, 0x39, 0x9B, 0x79,
-	0x2C, 0xC9, 0x05, 0x09, 0x02, 0x00, 0x01, 0x83, 0xFF, 0x7F, 0x17, 0x03,
-	0x00, 0x92, 0x2C, 0x01, 0x86, 0x03, 0x10, 0x06, 0x3A, 0xBB, 0x26, 0x81,
-	0x3D, 0x41, 0x25, 0x26, 0x01, 0x08, 0x0B, 0x37, 0x01, 0x8C, 0x80, 0x00,
-	0x37, 0x17, 0x02, 0x00, 0x17, 0x02, 0x00, 0x01, 0x8C, 0x80, 0x00, 0x17,
-	0x06, 0x19, 0x26, 0x01, 0x81, 0x7F, 0x17, 0x06, 0x05, 0x01, 0x84, 0x80,
-	0x00, 0x37, 0x26, 0x01, 0x83, 0xFE, 0x00, 0x17, 0x06, 0x05, 0x01, 0x88,
-	0x80, 0x00, 0x37, 0x03, 0x00, 0x04, 0x09, 0x02, 0x00, 0x01, 0x8C, 0x88,
-	0x01, 0x17, 0x03, 0x00, 0x16, 0xBF, 0xAA, 0x26, 0x06, 0x23, 0xBF, 0xAA,
-	0x26, 0x15, 0x26, 0x06, 0x18, 0x26, 0x01, 0x82, 0x00, 0x0F, 0x06, 0x05,
-	0x01, 0x82, 0x00, 0x04, 0x01, 0x26, 0x03, 0x01, 0x84, 0x02, 0x01, 0xB6,
-	0x02, 0x01, 0x12, 0x04, 0x65, 0x9B, 0x13, 0x04, 0x5A, 0x9B, 0x14, 0x9B,
-	0x02, 0x00, 0x2A, 0x00, 0x00, 0xB9, 0x26, 0x5A, 0x06, 0x07, 0x25, 0x06,
-	0x02, 0x66, 0x28, 0x04, 0x74, 0x00, 0x00, 0xC2, 0x01, 0x03, 0xC0, 0x44,
-	0x25, 0x44, 0x00, 0x00, 0xBF, 0xC6, 0x00, 0x03, 0x01, 0x00, 0x03, 0x00,
-	0xBF, 0xAA, 0x26, 0x06, 0x80, 0x50, 0xC1, 0x03, 0x01, 0xC1, 0x03, 0x02,
-	0x02, 0x01, 0x01, 0x08, 0x0E, 0x06, 0x16, 0x02, 0x02, 0x01, 0x0F, 0x0C,
-	0x06, 0x0D, 0x01, 0x01, 0x02, 0x02, 0x01, 0x10, 0x08, 0x0B, 0x02, 0x00,
-	0x37, 0x03, 0x00, 0x04, 0x2A, 0x02, 0x01, 0x01, 0x02, 0x10, 0x02, 0x01,
-	0x01, 0x06, 0x0C, 0x17, 0x02, 0x02, 0x01, 0x01, 0x0E, 0x02, 0x02, 0x01,
-	0x03, 0x0E, 0x37, 0x17, 0x06, 0x11, 0x02, 0x00, 0x01, 0x01, 0x02, 0x02,
-	0x5D, 0x01, 0x02, 0x0B, 0x02, 0x01, 0x08, 0x0B, 0x37, 0x03, 0x00, 0x04,
-	0xFF, 0x2C, 0x9B, 0x02, 0x00, 0x00, 0x00, 0xBF, 0x01, 0x01, 0x0E, 0x05,
-	0x02, 0x65, 0x28, 0xC1, 0x01, 0x08, 0x08, 0x82, 0x2E, 0x0E, 0x05, 0x02,
-	0x65, 0x28, 0x00, 0x00, 0xBF, 0x88, 0x2E, 0x05, 0x15, 0x01, 0x01, 0x0E,
-	0x05, 0x02, 0x69, 0x28, 0xC1, 0x01, 0x00, 0x0E, 0x05, 0x02, 0x69, 0x28,
-	0x01, 0x02, 0x88, 0x3E, 0x04, 0x1C, 0x01, 0x19, 0x0E, 0x05, 0x02, 0x69,
-	0x28, 0xC1, 0x01, 0x18, 0x0E, 0x05, 0x02, 0x69, 0x28, 0x84, 0x01, 0x18,
-	0xB6, 0x89, 0x84, 0x01, 0x18, 0x30, 0x05, 0x02, 0x69, 0x28, 0x00, 0x00,
-	0xBF, 0x06, 0x02, 0x6A, 0x28, 0x00, 0x00, 0x01, 0x02, 0x97, 0xC2, 0x01,
-	0x08, 0x0B, 0xC2, 0x08, 0x00, 0x00, 0x01, 0x03, 0x97, 0xC2, 0x01, 0x08,
-	0x0B, 0xC2, 0x08, 0x01, 0x08, 0x0B, 0xC2, 0x08, 0x00, 0x00, 0x01, 0x01,
-	0x97, 0xC2, 0x00, 0x00, 0x3A, 0x26, 0x58, 0x05, 0x01, 0x00, 0x25, 0xD0,
-	0x04, 0x76, 0x02, 0x03, 0x00, 0x91, 0x2E, 0x03, 0x01, 0x01, 0x00, 0x26,
-	0x02, 0x01, 0x0A, 0x06, 0x10, 0x26, 0x01, 0x01, 0x0B, 0x90, 0x08, 0x2C,
-	0x02, 0x00, 0x0E, 0x06, 0x01, 0x00, 0x5C, 0x04, 0x6A, 0x25, 0x01, 0x7F,
-	0x00, 0x00, 0x01, 0x15, 0x87, 0x3E, 0x44, 0x52, 0x25, 0x52, 0x25, 0x29,
-	0x00, 0x00, 0x01, 0x01, 0x44, 0xC4, 0x00, 0x00, 0x44, 0x38, 0x97, 0x44,
-	0x26, 0x06, 0x05, 0xC2, 0x25, 0x5D, 0x04, 0x78, 0x25, 0x00, 0x00, 0x26,
-	0x01, 0x81, 0xAC, 0x00, 0x0E, 0x06, 0x04, 0x25, 0x01, 0x7F, 0x00, 0x9A,
-	0x59, 0x00, 0x02, 0x03, 0x00, 0x79, 0x2C, 0x9A, 0x03, 0x01, 0x02, 0x01,
-	0x01, 0x0F, 0x17, 0x02, 0x01, 0x01, 0x04, 0x11, 0x01, 0x0F, 0x17, 0x02,
-	0x01, 0x01, 0x08, 0x11, 0x01, 0x0F, 0x17, 0x01, 0x00, 0x38, 0x0E, 0x06,
-	0x10, 0x25, 0x01, 0x00, 0x01, 0x18, 0x02, 0x00, 0x06, 0x03, 0x49, 0x04,
-	0x01, 0x4A, 0x04, 0x81, 0x0D, 0x01, 0x01, 0x38, 0x0E, 0x06, 0x10, 0x25,
-	0x01, 0x01, 0x01, 0x10, 0x02, 0x00, 0x06, 0x03, 0x49, 0x04, 0x01, 0x4A,
-	0x04, 0x80, 0x77, 0x01, 0x02, 0x38, 0x0E, 0x06, 0x10, 0x25, 0x01, 0x01,
-	0x01, 0x20, 0x02, 0x00, 0x06, 0x03, 0x49, 0x04, 0x01, 0x4A, 0x04, 0x80,
-	0x61, 0x01, 0x03, 0x38, 0x0E, 0x06, 0x0F, 0x25, 0x25, 0x01, 0x10, 0x02,
-	0x00, 0x06, 0x03, 0x47, 0x04, 0x01, 0x48, 0x04, 0x80, 0x4C, 0x01, 0x04,
-	0x38, 0x0E, 0x06, 0x0E, 0x25, 0x25, 0x01, 0x20, 0x02, 0x00, 0x06, 0x03,
-	0x47, 0x04, 0x01, 0x48, 0x04, 0x38, 0x01, 0x05, 0x38, 0x0E, 0x06, 0x0C,
-	0x25, 0x25, 0x02, 0x00, 0x06, 0x03, 0x4B, 0x04, 0x01, 0x4C, 0x04, 0x26,
-	0x26, 0x01, 0x09, 0x0F, 0x06, 0x02, 0x68, 0x28, 0x44, 0x25, 0x26, 0x01,
-	0x01, 0x17, 0x01, 0x04, 0x0B, 0x01, 0x10, 0x08, 0x44, 0x01, 0x08, 0x17,
-	0x01, 0x10, 0x44, 0x09, 0x02, 0x00, 0x06, 0x03, 0x45, 0x04, 0x01, 0x46,
-	0x00, 0x25, 0x00, 0x00, 0x9A, 0x01, 0x0C, 0x11, 0x01, 0x02, 0x0F, 0x00,
-	0x00, 0x9A, 0x01, 0x0C, 0x11, 0x26, 0x5B, 0x44, 0x01, 0x03, 0x0A, 0x17,
-	0x00, 0x00, 0x9A, 0x01, 0x0C, 0x11, 0x01, 0x01, 0x0E, 0x00, 0x00, 0x9A,
-	0x01, 0x0C, 0x11, 0x5A, 0x00, 0x00, 0x9A, 0x01, 0x81, 0x70, 0x17, 0x01,
-	0x20, 0x0D, 0x00, 0x00, 0x1B, 0x01, 0x00, 0x75, 0x2E, 0x26, 0x06, 0x22,
-	0x01, 0x01, 0x38, 0x0E, 0x06, 0x06, 0x25, 0x01, 0x00, 0x9E, 0x04, 0x14,
-	0x01, 0x02, 0x38, 0x0E, 0x06, 0x0D, 0x25, 0x77, 0x2E, 0x01, 0x01, 0x0E,
-	0x06, 0x03, 0x01, 0x10, 0x37, 0x04, 0x01, 0x25, 0x04, 0x01, 0x25, 0x7B,
-	0x2E, 0x05, 0x33, 0x2F, 0x06, 0x30, 0x86, 0x2E, 0x01, 0x14, 0x38, 0x0E,
-	0x06, 0x06, 0x25, 0x01, 0x02, 0x37, 0x04, 0x22, 0x01, 0x15, 0x38, 0x0E,
-	0x06, 0x09, 0x25, 0xAD, 0x06, 0x03, 0x01, 0x7F, 0x9E, 0x04, 0x13, 0x01,
-	0x16, 0x38, 0x0E, 0x06, 0x06, 0x25, 0x01, 0x01, 0x37, 0x04, 0x07, 0x25,
-	0x01, 0x04, 0x37, 0x01, 0x00, 0x25, 0x1A, 0x06, 0x03, 0x01, 0x08, 0x37,
-	0x00, 0x00, 0x1B, 0x26, 0x05, 0x13, 0x2F, 0x06, 0x10, 0x86, 0x2E, 0x01,
-	0x15, 0x0E, 0x06, 0x08, 0x25, 0xAD, 0x01, 0x00, 0x77, 0x3E, 0x04, 0x01,
-	0x20, 0x00, 0x00, 0xCE, 0x01, 0x07, 0x17, 0x01, 0x01, 0x0F, 0x06, 0x02,
-	0x72, 0x28, 0x00, 0x01, 0x03, 0x00, 0x29, 0x1A, 0x06, 0x05, 0x02, 0x00,
-	0x87, 0x3E, 0x00, 0xCE, 0x25, 0x04, 0x74, 0x00, 0x01, 0x14, 0xD1, 0x01,
-	0x01, 0xDE, 0x29, 0x26, 0x01, 0x00, 0xC8, 0x01, 0x16, 0xD1, 0xD7, 0x29,
-	0x00, 0x00, 0x01, 0x0B, 0xDE, 0x4E, 0x26, 0x26, 0x01, 0x03, 0x08, 0xDD,
-	0xDD, 0x18, 0x26, 0x58, 0x06, 0x02, 0x25, 0x00, 0xDD, 0x1D, 0x26, 0x06,
-	0x05, 0x84, 0x44, 0xD8, 0x04, 0x77, 0x25, 0x04, 0x6C, 0x00, 0x21, 0x01,
-	0x0F, 0xDE, 0x26, 0x92, 0x2C, 0x01, 0x86, 0x03, 0x10, 0x06, 0x0C, 0x01,
-	0x04, 0x08, 0xDD, 0x80, 0x2E, 0xDE, 0x78, 0x2E, 0xDE, 0x04, 0x02, 0x5E,
-	0xDD, 0x26, 0xDC, 0x84, 0x44, 0xD8, 0x00, 0x02, 0xA4, 0xA6, 0x08, 0xA2,
-	0x08, 0xA5, 0x08, 0xA7, 0x08, 0xA3, 0x08, 0x27, 0x08, 0x03, 0x00, 0x01,
-	0x01, 0xDE, 0x01, 0x27, 0x8E, 0x2E, 0x08, 0x91, 0x2E, 0x01, 0x01, 0x0B,
-	0x08, 0x02, 0x00, 0x06, 0x04, 0x5E, 0x02, 0x00, 0x08, 0x83, 0x2C, 0x38,
-	0x09, 0x26, 0x5B, 0x06, 0x24, 0x02, 0x00, 0x05, 0x04, 0x44, 0x5E, 0x44,
-	0x5F, 0x01, 0x04, 0x09, 0x26, 0x58, 0x06, 0x03, 0x25, 0x01, 0x00, 0x26,
-	0x01, 0x04, 0x08, 0x02, 0x00, 0x08, 0x03, 0x00, 0x44, 0x01, 0x04, 0x08,
-	0x38, 0x08, 0x44, 0x04, 0x03, 0x25, 0x01, 0x7F, 0x03, 0x01, 0xDD, 0x94,
-	0x2C, 0xDC, 0x7A, 0x01, 0x04, 0x19, 0x7A, 0x01, 0x04, 0x08, 0x01, 0x1C,
-	0x32, 0x7A, 0x01, 0x20, 0xD8, 0x8D, 0x8E, 0x2E, 0xDA, 0x91, 0x2E, 0x26,
-	0x01, 0x01, 0x0B, 0xDC, 0x90, 0x44, 0x26, 0x06, 0x0F, 0x5D, 0x38, 0x2C,
-	0x26, 0xC7, 0x05, 0x02, 0x62, 0x28, 0xDC, 0x44, 0x5E, 0x44, 0x04, 0x6E,
-	0x60, 0x01, 0x01, 0xDE, 0x01, 0x00, 0xDE, 0x02, 0x00, 0x06, 0x81, 0x5A,
-	0x02, 0x00, 0xDC, 0xA4, 0x06, 0x0E, 0x01, 0x83, 0xFE, 0x01, 0xDC, 0x89,
-	0xA4, 0x01, 0x04, 0x09, 0x26, 0xDC, 0x5D, 0xDA, 0xA6, 0x06, 0x16, 0x01,
-	0x00, 0xDC, 0x8B, 0xA6, 0x01, 0x04, 0x09, 0x26, 0xDC, 0x01, 0x02, 0x09,
-	0x26, 0xDC, 0x01, 0x00, 0xDE, 0x01, 0x03, 0x09, 0xD9, 0xA2, 0x06, 0x0C,
-	0x01, 0x01, 0xDC, 0x01, 0x01, 0xDC, 0x82, 0x2E, 0x01, 0x08, 0x09, 0xDE,
-	0xA5, 0x06, 0x19, 0x01, 0x0D, 0xDC, 0xA5, 0x01, 0x04, 0x09, 0x26, 0xDC,
-	0x01, 0x02, 0x09, 0xDC, 0x42, 0x06, 0x03, 0x01, 0x03, 0xDB, 0x43, 0x06,
-	0x03, 0x01, 0x01, 0xDB, 0xA7, 0x26, 0x06, 0x36, 0x01, 0x0A, 0xDC, 0x01,
-	0x04, 0x09, 0x26, 0xDC, 0x5F, 0xDC, 0x40, 0x01, 0x00, 0x26, 0x01, 0x82,
-	0x80, 0x80, 0x80, 0x00, 0x17, 0x06, 0x0A, 0x01, 0xFD, 0xFF, 0xFF, 0xFF,
-	0x7F, 0x17, 0x01, 0x1D, 0xDC, 0x26, 0x01, 0x20, 0x0A, 0x06, 0x0C, 0xA0,
-	0x11, 0x01, 0x01, 0x17, 0x06, 0x02, 0x26, 0xDC, 0x5C, 0x04, 0x6E, 0x60,
-	0x04, 0x01, 0x25, 0xA3, 0x06, 0x0A, 0x01, 0x0B, 0xDC, 0x01, 0x02, 0xDC,
-	0x01, 0x82, 0x00, 0xDC, 0x27, 0x26, 0x06, 0x1F, 0x01, 0x10, 0xDC, 0x01,
-	0x04, 0x09, 0x26, 0xDC, 0x5F, 0xDC, 0x85, 0x2C, 0x01, 0x00, 0xA0, 0x0F,
-	0x06, 0x0A, 0x26, 0x1E, 0x26, 0xDE, 0x84, 0x44, 0xD8, 0x5C, 0x04, 0x72,
-	0x60, 0x04, 0x01, 0x25, 0x02, 0x01, 0x58, 0x05, 0x11, 0x01, 0x15, 0xDC,
-	0x02, 0x01, 0x26, 0xDC, 0x26, 0x06, 0x06, 0x5D, 0x01, 0x00, 0xDE, 0x04,
-	0x77, 0x25, 0x00, 0x00, 0x01, 0x10, 0xDE, 0x79, 0x2C, 0x26, 0xCC, 0x06,
-	0x0C, 0xAB, 0x23, 0x26, 0x5E, 0xDD, 0x26, 0xDC, 0x84, 0x44, 0xD8, 0x04,
-	0x0D, 0x26, 0xCA, 0x44, 0xAB, 0x22, 0x26, 0x5C, 0xDD, 0x26, 0xDE, 0x84,
-	0x44, 0xD8, 0x00, 0x00, 0x9C, 0x01, 0x14, 0xDE, 0x01, 0x0C, 0xDD, 0x84,
-	0x01, 0x0C, 0xD8, 0x00, 0x00, 0x51, 0x26, 0x01, 0x00, 0x0E, 0x06, 0x02,
-	0x60, 0x00, 0xCE, 0x25, 0x04, 0x73, 0x00, 0x26, 0xDC, 0xD8, 0x00, 0x00,
-	0x26, 0xDE, 0xD8, 0x00, 0x01, 0x03, 0x00, 0x41, 0x25, 0x26, 0x01, 0x10,
-	0x17, 0x06, 0x06, 0x01, 0x04, 0xDE, 0x02, 0x00, 0xDE, 0x26, 0x01, 0x08,
-	0x17, 0x06, 0x06, 0x01, 0x03, 0xDE, 0x02, 0x00, 0xDE, 0x26, 0x01, 0x20,
-	0x17, 0x06, 0x06, 0x01, 0x05, 0xDE, 0x02, 0x00, 0xDE, 0x26, 0x01, 0x80,
-	0x40, 0x17, 0x06, 0x06, 0x01, 0x06, 0xDE, 0x02, 0x00, 0xDE, 0x01, 0x04,
-	0x17, 0x06, 0x06, 0x01, 0x02, 0xDE, 0x02, 0x00, 0xDE, 0x00, 0x00, 0x26,
-	0x01, 0x08, 0x4F, 0xDE, 0xDE, 0x00, 0x00, 0x26, 0x01, 0x10, 0x4F, 0xDE,
-	0xDC, 0x00, 0x00, 0x26, 0x52, 0x06, 0x02, 0x25, 0x00, 0xCE, 0x25, 0x04,
-	0x76
+	0x46, 0x26, 0x00, 0x00, 0x84, 0x2F, 0x01, 0x0E, 0x0E, 0x06, 0x04, 0x01,
+	0x00, 0x04, 0x02, 0x01, 0x05, 0x00, 0x00, 0x42, 0x06, 0x04, 0x01, 0x06,
+	0x04, 0x02, 0x01, 0x00, 0x00, 0x00, 0x8A, 0x2F, 0x27, 0x06, 0x08, 0x01,
+	0x01, 0x09, 0x01, 0x11, 0x07, 0x04, 0x03, 0x26, 0x01, 0x05, 0x00, 0x01,
+	0x43, 0x03, 0x00, 0x26, 0x01, 0x00, 0x45, 0x06, 0x03, 0x02, 0x00, 0x08,
+	0x44, 0x06, 0x03, 0x02, 0x00, 0x08, 0x27, 0x06, 0x06, 0x01, 0x01, 0x0B,
+	0x01, 0x06, 0x08, 0x00, 0x00, 0x8D, 0x41, 0x27, 0x06, 0x03, 0x01, 0x09,
+	0x08, 0x00, 0x01, 0x42, 0x27, 0x06, 0x1E, 0x01, 0x00, 0x03, 0x00, 0x27,
+	0x06, 0x0E, 0x27, 0x01, 0x01, 0x17, 0x02, 0x00, 0x08, 0x03, 0x00, 0x01,
+	0x01, 0x11, 0x04, 0x6F, 0x26, 0x02, 0x00, 0x01, 0x01, 0x0B, 0x01, 0x06,
+	0x08, 0x00, 0x00, 0x93, 0x2D, 0x06, 0x07, 0x92, 0x2D, 0x01, 0x04, 0x08,
+	0x04, 0x02, 0x01, 0x00, 0x00, 0x00, 0x81, 0x2E, 0x46, 0x11, 0x01, 0x01,
+	0x17, 0x36, 0x00, 0x00, 0xA4, 0xD5, 0x27, 0x01, 0x07, 0x17, 0x01, 0x00,
+	0x39, 0x0E, 0x06, 0x09, 0x26, 0x01, 0x10, 0x17, 0x06, 0x01, 0xA4, 0x04,
+	0x35, 0x01, 0x01, 0x39, 0x0E, 0x06, 0x2C, 0x26, 0x26, 0x01, 0x00, 0x79,
+	0x40, 0xB9, 0x8A, 0x2F, 0x01, 0x01, 0x0E, 0x01, 0x01, 0xAE, 0x38, 0x06,
+	0x17, 0x2A, 0x1A, 0x37, 0x06, 0x04, 0xD5, 0x26, 0x04, 0x78, 0x01, 0x80,
+	0x64, 0xCC, 0x01, 0x01, 0x79, 0x40, 0x01, 0x17, 0x89, 0x40, 0x04, 0x01,
+	0xA4, 0x04, 0x03, 0x74, 0x29, 0x26, 0x04, 0xFF, 0x34, 0x01, 0x27, 0x03,
+	0x00, 0x09, 0x27, 0x5A, 0x06, 0x02, 0x6A, 0x29, 0x02, 0x00, 0x00, 0x00,
+	0x9F, 0x01, 0x0F, 0x17, 0x00, 0x00, 0x78, 0x2F, 0x01, 0x00, 0x39, 0x0E,
+	0x06, 0x10, 0x26, 0x27, 0x01, 0x01, 0x0D, 0x06, 0x03, 0x26, 0x01, 0x02,
+	0x78, 0x40, 0x01, 0x00, 0x04, 0x21, 0x01, 0x01, 0x39, 0x0E, 0x06, 0x14,
+	0x26, 0x01, 0x00, 0x78, 0x40, 0x27, 0x01, 0x80, 0x64, 0x0E, 0x06, 0x05,
+	0x01, 0x82, 0x00, 0x08, 0x29, 0x5C, 0x04, 0x07, 0x26, 0x01, 0x82, 0x00,
+	0x08, 0x29, 0x26, 0x00, 0x00, 0x01, 0x00, 0x30, 0x06, 0x05, 0x3B, 0xB2,
+	0x38, 0x04, 0x78, 0x27, 0x06, 0x04, 0x01, 0x01, 0x94, 0x40, 0x00, 0x01,
+	0xC6, 0xB0, 0xC6, 0xB0, 0xC8, 0x86, 0x46, 0x27, 0x03, 0x00, 0xBD, 0xA0,
+	0xA0, 0x02, 0x00, 0x4F, 0x27, 0x5A, 0x06, 0x0A, 0x01, 0x03, 0xAE, 0x06,
+	0x02, 0x74, 0x29, 0x26, 0x04, 0x03, 0x5E, 0x8C, 0x3E, 0x00, 0x00, 0x30,
+	0x06, 0x0B, 0x88, 0x2F, 0x01, 0x14, 0x0D, 0x06, 0x02, 0x74, 0x29, 0x04,
+	0x11, 0xD5, 0x01, 0x07, 0x17, 0x27, 0x01, 0x02, 0x0D, 0x06, 0x06, 0x06,
+	0x02, 0x74, 0x29, 0x04, 0x70, 0x26, 0xC9, 0x01, 0x01, 0x0D, 0x34, 0x38,
+	0x06, 0x02, 0x63, 0x29, 0x27, 0x01, 0x01, 0xCF, 0x37, 0xB8, 0x00, 0x01,
+	0xBF, 0x01, 0x0B, 0x0E, 0x05, 0x02, 0x74, 0x29, 0x27, 0x01, 0x03, 0x0E,
+	0x06, 0x08, 0xC7, 0x06, 0x02, 0x6A, 0x29, 0x46, 0x26, 0x00, 0x46, 0x59,
+	0xC7, 0xB0, 0x27, 0x06, 0x23, 0xC7, 0xB0, 0x27, 0x58, 0x27, 0x06, 0x18,
+	0x27, 0x01, 0x82, 0x00, 0x0F, 0x06, 0x05, 0x01, 0x82, 0x00, 0x04, 0x01,
+	0x27, 0x03, 0x00, 0x86, 0x02, 0x00, 0xBD, 0x02, 0x00, 0x55, 0x04, 0x65,
+	0xA0, 0x56, 0x04, 0x5A, 0xA0, 0xA0, 0x57, 0x27, 0x06, 0x02, 0x36, 0x00,
+	0x26, 0x2C, 0x00, 0x00, 0x7B, 0x2D, 0xA6, 0x01, 0x7F, 0xB6, 0x27, 0x5A,
+	0x06, 0x02, 0x36, 0x29, 0x27, 0x05, 0x02, 0x74, 0x29, 0x39, 0x17, 0x0D,
+	0x06, 0x02, 0x76, 0x29, 0x3D, 0x00, 0x00, 0xA1, 0xBF, 0x01, 0x14, 0x0D,
+	0x06, 0x02, 0x74, 0x29, 0x86, 0x01, 0x0C, 0x08, 0x01, 0x0C, 0xBD, 0xA0,
+	0x86, 0x27, 0x01, 0x0C, 0x08, 0x01, 0x0C, 0x31, 0x05, 0x02, 0x66, 0x29,
+	0x00, 0x00, 0xC0, 0x06, 0x02, 0x74, 0x29, 0x06, 0x02, 0x68, 0x29, 0x00,
+	0x02, 0xBF, 0x01, 0x04, 0x0E, 0x05, 0x02, 0x74, 0x29, 0xC6, 0x01, 0x10,
+	0x0B, 0x03, 0x00, 0xC6, 0x02, 0x00, 0x38, 0x03, 0x00, 0xC6, 0x03, 0x01,
+	0x02, 0x01, 0x93, 0x2D, 0x0F, 0x06, 0x09, 0x02, 0x01, 0xCD, 0x01, 0x00,
+	0x03, 0x01, 0x04, 0x04, 0x86, 0x02, 0x01, 0xBD, 0x02, 0x01, 0x02, 0x00,
+	0x3C, 0xA0, 0x01, 0x00, 0x91, 0x40, 0x00, 0x0B, 0xBF, 0x01, 0x02, 0x0E,
+	0x05, 0x02, 0x74, 0x29, 0xC6, 0x03, 0x00, 0x02, 0x00, 0x9A, 0x2D, 0x0A,
+	0x02, 0x00, 0x99, 0x2D, 0x0F, 0x38, 0x06, 0x02, 0x75, 0x29, 0x02, 0x00,
+	0x98, 0x2D, 0x0D, 0x06, 0x02, 0x6D, 0x29, 0x02, 0x00, 0x9B, 0x3E, 0x8E,
+	0x01, 0x20, 0xBD, 0x01, 0x00, 0x03, 0x01, 0xC8, 0x03, 0x02, 0x02, 0x02,
+	0x01, 0x20, 0x0F, 0x06, 0x02, 0x72, 0x29, 0x86, 0x02, 0x02, 0xBD, 0x02,
+	0x02, 0x90, 0x2F, 0x0E, 0x02, 0x02, 0x01, 0x00, 0x0F, 0x17, 0x06, 0x0B,
+	0x8F, 0x86, 0x02, 0x02, 0x31, 0x06, 0x04, 0x01, 0x7F, 0x03, 0x01, 0x8F,
+	0x86, 0x02, 0x02, 0x32, 0x02, 0x02, 0x90, 0x40, 0x02, 0x00, 0x97, 0x02,
+	0x01, 0x9D, 0xC6, 0x27, 0xCA, 0x5A, 0x06, 0x02, 0x64, 0x29, 0x27, 0xD4,
+	0x02, 0x00, 0x01, 0x86, 0x03, 0x0A, 0x17, 0x06, 0x02, 0x64, 0x29, 0x7B,
+	0x02, 0x01, 0x9D, 0xC8, 0x06, 0x02, 0x65, 0x29, 0x27, 0x06, 0x81, 0x68,
+	0xC6, 0xB0, 0xAB, 0x03, 0x03, 0xA9, 0x03, 0x04, 0xA7, 0x03, 0x05, 0xAA,
+	0x03, 0x06, 0xAC, 0x03, 0x07, 0xA8, 0x03, 0x08, 0x28, 0x03, 0x09, 0xAD,
+	0x03, 0x0A, 0x27, 0x06, 0x81, 0x36, 0xC6, 0x01, 0x00, 0x39, 0x0E, 0x06,
+	0x0F, 0x26, 0x02, 0x03, 0x05, 0x02, 0x6E, 0x29, 0x01, 0x00, 0x03, 0x03,
+	0xC5, 0x04, 0x81, 0x1D, 0x01, 0x01, 0x39, 0x0E, 0x06, 0x0F, 0x26, 0x02,
+	0x05, 0x05, 0x02, 0x6E, 0x29, 0x01, 0x00, 0x03, 0x05, 0xC3, 0x04, 0x81,
+	0x08, 0x01, 0x83, 0xFE, 0x01, 0x39, 0x0E, 0x06, 0x0F, 0x26, 0x02, 0x04,
+	0x05, 0x02, 0x6E, 0x29, 0x01, 0x00, 0x03, 0x04, 0xC4, 0x04, 0x80, 0x71,
+	0x01, 0x0D, 0x39, 0x0E, 0x06, 0x0F, 0x26, 0x02, 0x06, 0x05, 0x02, 0x6E,
+	0x29, 0x01, 0x00, 0x03, 0x06, 0xC1, 0x04, 0x80, 0x5C, 0x01, 0x0A, 0x39,
+	0x0E, 0x06, 0x0F, 0x26, 0x02, 0x07, 0x05, 0x02, 0x6E, 0x29, 0x01, 0x00,
+	0x03, 0x07, 0xC1, 0x04, 0x80, 0x47, 0x01, 0x0B, 0x39, 0x0E, 0x06, 0x0E,
+	0x26, 0x02, 0x08, 0x05, 0x02, 0x6E, 0x29, 0x01, 0x00, 0x03, 0x08, 0xC1,
+	0x04, 0x33, 0x01, 0x10, 0x39, 0x0E, 0x06, 0x0E, 0x26, 0x02, 0x09, 0x05,
+	0x02, 0x6E, 0x29, 0x01, 0x00, 0x03, 0x09, 0xB4, 0x04, 0x1F, 0x01, 0x23,
+	0x39, 0x0E, 0x06, 0x16, 0x26, 0x02, 0x0A, 0x05, 0x02, 0x6E, 0x29, 0x01,
+	0x00, 0x03, 0x0A, 0xC6, 0x06, 0x02, 0x68, 0x29, 0x01, 0x01, 0x91, 0x40,
+	0x04, 0x03, 0x6E, 0x29, 0x26, 0x04, 0xFE, 0x46, 0x02, 0x04, 0x06, 0x0D,
+	0x02, 0x04, 0x01, 0x05, 0x0F, 0x06, 0x02, 0x6B, 0x29, 0x01, 0x01, 0x8A,
+	0x40, 0xA0, 0x04, 0x0C, 0xA9, 0x01, 0x05, 0x0F, 0x06, 0x02, 0x6B, 0x29,
+	0x01, 0x01, 0x8A, 0x40, 0xA0, 0x02, 0x01, 0x00, 0x04, 0xBF, 0x01, 0x0C,
+	0x0E, 0x05, 0x02, 0x74, 0x29, 0xC8, 0x01, 0x03, 0x0E, 0x05, 0x02, 0x6F,
+	0x29, 0xC6, 0x27, 0x7E, 0x40, 0x27, 0x01, 0x20, 0x10, 0x06, 0x02, 0x6F,
+	0x29, 0x42, 0x46, 0x11, 0x01, 0x01, 0x17, 0x05, 0x02, 0x6F, 0x29, 0xC8,
+	0x27, 0x01, 0x81, 0x05, 0x0F, 0x06, 0x02, 0x6F, 0x29, 0x27, 0x80, 0x40,
+	0x7F, 0x46, 0xBD, 0x97, 0x2D, 0x01, 0x86, 0x03, 0x10, 0x03, 0x00, 0x7B,
+	0x2D, 0xD2, 0x03, 0x01, 0x01, 0x02, 0x03, 0x02, 0x02, 0x00, 0x06, 0x21,
+	0xC8, 0x27, 0x27, 0x01, 0x02, 0x0A, 0x46, 0x01, 0x06, 0x0F, 0x38, 0x06,
+	0x02, 0x6F, 0x29, 0x03, 0x02, 0xC8, 0x02, 0x01, 0x01, 0x01, 0x0B, 0x01,
+	0x03, 0x08, 0x0E, 0x05, 0x02, 0x6F, 0x29, 0x04, 0x08, 0x02, 0x01, 0x06,
+	0x04, 0x01, 0x00, 0x03, 0x02, 0xC6, 0x27, 0x03, 0x03, 0x27, 0x01, 0x84,
+	0x00, 0x0F, 0x06, 0x02, 0x70, 0x29, 0x86, 0x46, 0xBD, 0x02, 0x02, 0x02,
+	0x01, 0x02, 0x03, 0x52, 0x27, 0x06, 0x01, 0x29, 0x26, 0xA0, 0x00, 0x02,
+	0x03, 0x00, 0x03, 0x01, 0x02, 0x00, 0x9C, 0x02, 0x01, 0x02, 0x00, 0x3A,
+	0x27, 0x01, 0x00, 0x0E, 0x06, 0x02, 0x62, 0x00, 0xD7, 0x04, 0x74, 0x02,
+	0x01, 0x00, 0x03, 0x00, 0xC8, 0xB0, 0x27, 0x06, 0x80, 0x43, 0xC8, 0x01,
+	0x01, 0x39, 0x0E, 0x06, 0x06, 0x26, 0x01, 0x81, 0x7F, 0x04, 0x2E, 0x01,
+	0x80, 0x40, 0x39, 0x0E, 0x06, 0x07, 0x26, 0x01, 0x83, 0xFE, 0x00, 0x04,
+	0x20, 0x01, 0x80, 0x41, 0x39, 0x0E, 0x06, 0x07, 0x26, 0x01, 0x84, 0x80,
+	0x00, 0x04, 0x12, 0x01, 0x80, 0x42, 0x39, 0x0E, 0x06, 0x07, 0x26, 0x01,
+	0x88, 0x80, 0x00, 0x04, 0x04, 0x01, 0x00, 0x46, 0x26, 0x02, 0x00, 0x38,
+	0x03, 0x00, 0x04, 0xFF, 0x39, 0xA0, 0x7B, 0x2D, 0xD0, 0x05, 0x09, 0x02,
+	0x00, 0x01, 0x83, 0xFF, 0x7F, 0x17, 0x03, 0x00, 0x97, 0x2D, 0x01, 0x86,
+	0x03, 0x10, 0x06, 0x3A, 0xC2, 0x27, 0x83, 0x3F, 0x43, 0x26, 0x27, 0x01,
+	0x08, 0x0B, 0x38, 0x01, 0x8C, 0x80, 0x00, 0x38, 0x17, 0x02, 0x00, 0x17,
+	0x02, 0x00, 0x01, 0x8C, 0x80, 0x00, 0x17, 0x06, 0x19, 0x27, 0x01, 0x81,
+	0x7F, 0x17, 0x06, 0x05, 0x01, 0x84, 0x80, 0x00, 0x38, 0x27, 0x01, 0x83,
+	0xFE, 0x00, 0x17, 0x06, 0x05, 0x01, 0x88, 0x80, 0x00, 0x38, 0x03, 0x00,
+	0x04, 0x09, 0x02, 0x00, 0x01, 0x8C, 0x88, 0x01, 0x17, 0x03, 0x00, 0x16,
+	0xC6, 0xB0, 0x27, 0x06, 0x23, 0xC6, 0xB0, 0x27, 0x15, 0x27, 0x06, 0x18,
+	0x27, 0x01, 0x82, 0x00, 0x0F, 0x06, 0x05, 0x01, 0x82, 0x00, 0x04, 0x01,
+	0x27, 0x03, 0x01, 0x86, 0x02, 0x01, 0xBD, 0x02, 0x01, 0x12, 0x04, 0x65,
+	0xA0, 0x13, 0x04, 0x5A, 0xA0, 0x14, 0xA0, 0x02, 0x00, 0x2B, 0x00, 0x00,
+	0xC0, 0x27, 0x5C, 0x06, 0x07, 0x26, 0x06, 0x02, 0x68, 0x29, 0x04, 0x74,
+	0x00, 0x00, 0xC9, 0x01, 0x03, 0xC7, 0x46, 0x26, 0x46, 0x00, 0x00, 0xC6,
+	0xCD, 0x00, 0x03, 0x01, 0x00, 0x03, 0x00, 0xC6, 0xB0, 0x27, 0x06, 0x80,
+	0x50, 0xC8, 0x03, 0x01, 0xC8, 0x03, 0x02, 0x02, 0x01, 0x01, 0x08, 0x0E,
+	0x06, 0x16, 0x02, 0x02, 0x01, 0x0F, 0x0C, 0x06, 0x0D, 0x01, 0x01, 0x02,
+	0x02, 0x01, 0x10, 0x08, 0x0B, 0x02, 0x00, 0x38, 0x03, 0x00, 0x04, 0x2A,
+	0x02, 0x01, 0x01, 0x02, 0x10, 0x02, 0x01, 0x01, 0x06, 0x0C, 0x17, 0x02,
+	0x02, 0x01, 0x01, 0x0E, 0x02, 0x02, 0x01, 0x03, 0x0E, 0x38, 0x17, 0x06,
+	0x11, 0x02, 0x00, 0x01, 0x01, 0x02, 0x02, 0x5F, 0x01, 0x02, 0x0B, 0x02,
+	0x01, 0x08, 0x0B, 0x38, 0x03, 0x00, 0x04, 0xFF, 0x2C, 0xA0, 0x02, 0x00,
+	0x00, 0x00, 0xC6, 0x01, 0x01, 0x0E, 0x05, 0x02, 0x67, 0x29, 0xC8, 0x01,
+	0x08, 0x08, 0x84, 0x2F, 0x0E, 0x05, 0x02, 0x67, 0x29, 0x00, 0x00, 0xC6,
+	0x8A, 0x2F, 0x05, 0x15, 0x01, 0x01, 0x0E, 0x05, 0x02, 0x6B, 0x29, 0xC8,
+	0x01, 0x00, 0x0E, 0x05, 0x02, 0x6B, 0x29, 0x01, 0x02, 0x8A, 0x40, 0x04,
+	0x1C, 0x01, 0x19, 0x0E, 0x05, 0x02, 0x6B, 0x29, 0xC8, 0x01, 0x18, 0x0E,
+	0x05, 0x02, 0x6B, 0x29, 0x86, 0x01, 0x18, 0xBD, 0x8B, 0x86, 0x01, 0x18,
+	0x31, 0x05, 0x02, 0x6B, 0x29, 0x00, 0x00, 0xC6, 0x06, 0x02, 0x6C, 0x29,
+	0x00, 0x00, 0x01, 0x02, 0x9C, 0xC9, 0x01, 0x08, 0x0B, 0xC9, 0x08, 0x00,
+	0x00, 0x01, 0x03, 0x9C, 0xC9, 0x01, 0x08, 0x0B, 0xC9, 0x08, 0x01, 0x08,
+	0x0B, 0xC9, 0x08, 0x00, 0x00, 0x01, 0x01, 0x9C, 0xC9, 0x00, 0x00, 0x3B,
+	0x27, 0x5A, 0x05, 0x01, 0x00, 0x26, 0xD7, 0x04, 0x76, 0x02, 0x03, 0x00,
+	0x96, 0x2F, 0x03, 0x01, 0x01, 0x00, 0x27, 0x02, 0x01, 0x0A, 0x06, 0x10,
+	0x27, 0x01, 0x01, 0x0B, 0x95, 0x08, 0x2D, 0x02, 0x00, 0x0E, 0x06, 0x01,
+	0x00, 0x5E, 0x04, 0x6A, 0x26, 0x01, 0x7F, 0x00, 0x00, 0x01, 0x15, 0x89,
+	0x40, 0x46, 0x54, 0x26, 0x54, 0x26, 0x2A, 0x00, 0x00, 0x01, 0x01, 0x46,
+	0xCB, 0x00, 0x00, 0x46, 0x39, 0x9C, 0x46, 0x27, 0x06, 0x05, 0xC9, 0x26,
+	0x5F, 0x04, 0x78, 0x26, 0x00, 0x00, 0x27, 0x01, 0x81, 0xAC, 0x00, 0x0E,
+	0x06, 0x04, 0x26, 0x01, 0x7F, 0x00, 0x9F, 0x5B, 0x00, 0x02, 0x03, 0x00,
+	0x7B, 0x2D, 0x9F, 0x03, 0x01, 0x02, 0x01, 0x01, 0x0F, 0x17, 0x02, 0x01,
+	0x01, 0x04, 0x11, 0x01, 0x0F, 0x17, 0x02, 0x01, 0x01, 0x08, 0x11, 0x01,
+	0x0F, 0x17, 0x01, 0x00, 0x39, 0x0E, 0x06, 0x10, 0x26, 0x01, 0x00, 0x01,
+	0x18, 0x02, 0x00, 0x06, 0x03, 0x4B, 0x04, 0x01, 0x4C, 0x04, 0x81, 0x0D,
+	0x01, 0x01, 0x39, 0x0E, 0x06, 0x10, 0x26, 0x01, 0x01, 0x01, 0x10, 0x02,
+	0x00, 0x06, 0x03, 0x4B, 0x04, 0x01, 0x4C, 0x04, 0x80, 0x77, 0x01, 0x02,
+	0x39, 0x0E, 0x06, 0x10, 0x26, 0x01, 0x01, 0x01, 0x20, 0x02, 0x00, 0x06,
+	0x03, 0x4B, 0x04, 0x01, 0x4C, 0x04, 0x80, 0x61, 0x01, 0x03, 0x39, 0x0E,
+	0x06, 0x0F, 0x26, 0x26, 0x01, 0x10, 0x02, 0x00, 0x06, 0x03, 0x49, 0x04,
+	0x01, 0x4A, 0x04, 0x80, 0x4C, 0x01, 0x04, 0x39, 0x0E, 0x06, 0x0E, 0x26,
+	0x26, 0x01, 0x20, 0x02, 0x00, 0x06, 0x03, 0x49, 0x04, 0x01, 0x4A, 0x04,
+	0x38, 0x01, 0x05, 0x39, 0x0E, 0x06, 0x0C, 0x26, 0x26, 0x02, 0x00, 0x06,
+	0x03, 0x4D, 0x04, 0x01, 0x4E, 0x04, 0x26, 0x27, 0x01, 0x09, 0x0F, 0x06,
+	0x02, 0x6A, 0x29, 0x46, 0x26, 0x27, 0x01, 0x01, 0x17, 0x01, 0x04, 0x0B,
+	0x01, 0x10, 0x08, 0x46, 0x01, 0x08, 0x17, 0x01, 0x10, 0x46, 0x09, 0x02,
+	0x00, 0x06, 0x03, 0x47, 0x04, 0x01, 0x48, 0x00, 0x26, 0x00, 0x00, 0x9F,
+	0x01, 0x0C, 0x11, 0x01, 0x02, 0x0F, 0x00, 0x00, 0x9F, 0x01, 0x0C, 0x11,
+	0x27, 0x5D, 0x46, 0x01, 0x03, 0x0A, 0x17, 0x00, 0x00, 0x9F, 0x01, 0x0C,
+	0x11, 0x01, 0x01, 0x0E, 0x00, 0x00, 0x9F, 0x01, 0x0C, 0x11, 0x5C, 0x00,
+	0x00, 0x9F, 0x01, 0x81, 0x70, 0x17, 0x01, 0x20, 0x0D, 0x00, 0x00, 0x1B,
+	0x01, 0x00, 0x77, 0x2F, 0x27, 0x06, 0x22, 0x01, 0x01, 0x39, 0x0E, 0x06,
+	0x06, 0x26, 0x01, 0x00, 0xA3, 0x04, 0x14, 0x01, 0x02, 0x39, 0x0E, 0x06,
+	0x0D, 0x26, 0x79, 0x2F, 0x01, 0x01, 0x0E, 0x06, 0x03, 0x01, 0x10, 0x38,
+	0x04, 0x01, 0x26, 0x04, 0x01, 0x26, 0x7D, 0x2F, 0x05, 0x33, 0x30, 0x06,
+	0x30, 0x88, 0x2F, 0x01, 0x14, 0x39, 0x0E, 0x06, 0x06, 0x26, 0x01, 0x02,
+	0x38, 0x04, 0x22, 0x01, 0x15, 0x39, 0x0E, 0x06, 0x09, 0x26, 0xB3, 0x06,
+	0x03, 0x01, 0x7F, 0xA3, 0x04, 0x13, 0x01, 0x16, 0x39, 0x0E, 0x06, 0x06,
+	0x26, 0x01, 0x01, 0x38, 0x04, 0x07, 0x26, 0x01, 0x04, 0x38, 0x01, 0x00,
+	0x26, 0x1A, 0x06, 0x03, 0x01, 0x08, 0x38, 0x00, 0x00, 0x1B, 0x27, 0x05,
+	0x13, 0x30, 0x06, 0x10, 0x88, 0x2F, 0x01, 0x15, 0x0E, 0x06, 0x08, 0x26,
+	0xB3, 0x01, 0x00, 0x79, 0x40, 0x04, 0x01, 0x21, 0x00, 0x00, 0xD5, 0x01,
+	0x07, 0x17, 0x01, 0x01, 0x0F, 0x06, 0x02, 0x74, 0x29, 0x00, 0x01, 0x03,
+	0x00, 0x2A, 0x1A, 0x06, 0x05, 0x02, 0x00, 0x89, 0x40, 0x00, 0xD5, 0x26,
+	0x04, 0x74, 0x00, 0x01, 0x14, 0xD8, 0x01, 0x01, 0xE5, 0x2A, 0x27, 0x01,
+	0x00, 0xCF, 0x01, 0x16, 0xD8, 0xDE, 0x2A, 0x00, 0x00, 0x01, 0x0B, 0xE5,
+	0x50, 0x27, 0x27, 0x01, 0x03, 0x08, 0xE4, 0xE4, 0x18, 0x27, 0x5A, 0x06,
+	0x02, 0x26, 0x00, 0xE4, 0x1D, 0x27, 0x06, 0x05, 0x86, 0x46, 0xDF, 0x04,
+	0x77, 0x26, 0x04, 0x6C, 0x00, 0x22, 0x01, 0x0F, 0xE5, 0x27, 0x97, 0x2D,
+	0x01, 0x86, 0x03, 0x10, 0x06, 0x0C, 0x01, 0x04, 0x08, 0xE4, 0x82, 0x2F,
+	0xE5, 0x7A, 0x2F, 0xE5, 0x04, 0x02, 0x60, 0xE4, 0x27, 0xE3, 0x86, 0x46,
+	0xDF, 0x00, 0x02, 0xA9, 0xAB, 0x08, 0xA7, 0x08, 0xAA, 0x08, 0xAC, 0x08,
+	0xA8, 0x08, 0x28, 0x08, 0xAD, 0x08, 0x03, 0x00, 0x01, 0x01, 0xE5, 0x01,
+	0x27, 0x90, 0x2F, 0x08, 0x96, 0x2F, 0x01, 0x01, 0x0B, 0x08, 0x02, 0x00,
+	0x06, 0x04, 0x60, 0x02, 0x00, 0x08, 0x85, 0x2D, 0x39, 0x09, 0x27, 0x5D,
+	0x06, 0x24, 0x02, 0x00, 0x05, 0x04, 0x46, 0x60, 0x46, 0x61, 0x01, 0x04,
+	0x09, 0x27, 0x5A, 0x06, 0x03, 0x26, 0x01, 0x00, 0x27, 0x01, 0x04, 0x08,
+	0x02, 0x00, 0x08, 0x03, 0x00, 0x46, 0x01, 0x04, 0x08, 0x39, 0x08, 0x46,
+	0x04, 0x03, 0x26, 0x01, 0x7F, 0x03, 0x01, 0xE4, 0x99, 0x2D, 0xE3, 0x7C,
+	0x01, 0x04, 0x19, 0x7C, 0x01, 0x04, 0x08, 0x01, 0x1C, 0x33, 0x7C, 0x01,
+	0x20, 0xDF, 0x8F, 0x90, 0x2F, 0xE1, 0x96, 0x2F, 0x27, 0x01, 0x01, 0x0B,
+	0xE3, 0x95, 0x46, 0x27, 0x06, 0x0F, 0x5F, 0x39, 0x2D, 0x27, 0xCE, 0x05,
+	0x02, 0x64, 0x29, 0xE3, 0x46, 0x60, 0x46, 0x04, 0x6E, 0x62, 0x01, 0x01,
+	0xE5, 0x01, 0x00, 0xE5, 0x02, 0x00, 0x06, 0x81, 0x6D, 0x02, 0x00, 0xE3,
+	0xA9, 0x06, 0x0E, 0x01, 0x83, 0xFE, 0x01, 0xE3, 0x8B, 0xA9, 0x01, 0x04,
+	0x09, 0x27, 0xE3, 0x5F, 0xE1, 0xAB, 0x06, 0x16, 0x01, 0x00, 0xE3, 0x8D,
+	0xAB, 0x01, 0x04, 0x09, 0x27, 0xE3, 0x01, 0x02, 0x09, 0x27, 0xE3, 0x01,
+	0x00, 0xE5, 0x01, 0x03, 0x09, 0xE0, 0xA7, 0x06, 0x0C, 0x01, 0x01, 0xE3,
+	0x01, 0x01, 0xE3, 0x84, 0x2F, 0x01, 0x08, 0x09, 0xE5, 0xAA, 0x06, 0x19,
+	0x01, 0x0D, 0xE3, 0xAA, 0x01, 0x04, 0x09, 0x27, 0xE3, 0x01, 0x02, 0x09,
+	0xE3, 0x44, 0x06, 0x03, 0x01, 0x03, 0xE2, 0x45, 0x06, 0x03, 0x01, 0x01,
+	0xE2, 0xAC, 0x27, 0x06, 0x36, 0x01, 0x0A, 0xE3, 0x01, 0x04, 0x09, 0x27,
+	0xE3, 0x61, 0xE3, 0x42, 0x01, 0x00, 0x27, 0x01, 0x82, 0x80, 0x80, 0x80,
+	0x00, 0x17, 0x06, 0x0A, 0x01, 0xFD, 0xFF, 0xFF, 0xFF, 0x7F, 0x17, 0x01,
+	0x1D, 0xE3, 0x27, 0x01, 0x20, 0x0A, 0x06, 0x0C, 0xA5, 0x11, 0x01, 0x01,
+	0x17, 0x06, 0x02, 0x27, 0xE3, 0x5E, 0x04, 0x6E, 0x62, 0x04, 0x01, 0x26,
+	0xA8, 0x06, 0x0A, 0x01, 0x0B, 0xE3, 0x01, 0x02, 0xE3, 0x01, 0x82, 0x00,
+	0xE3, 0x28, 0x27, 0x06, 0x1F, 0x01, 0x10, 0xE3, 0x01, 0x04, 0x09, 0x27,
+	0xE3, 0x61, 0xE3, 0x87, 0x2D, 0x01, 0x00, 0xA5, 0x0F, 0x06, 0x0A, 0x27,
+	0x1E, 0x27, 0xE5, 0x86, 0x46, 0xDF, 0x5E, 0x04, 0x72, 0x62, 0x04, 0x01,
+	0x26, 0xAD, 0x27, 0x06, 0x0E, 0x01, 0x23, 0xE3, 0x01, 0x04, 0x09, 0x27,
+	0xE3, 0x1F, 0x86, 0x46, 0xDF, 0x04, 0x01, 0x26, 0x02, 0x01, 0x5A, 0x05,
+	0x11, 0x01, 0x15, 0xE3, 0x02, 0x01, 0x27, 0xE3, 0x27, 0x06, 0x06, 0x5F,
+	0x01, 0x00, 0xE5, 0x04, 0x77, 0x26, 0x00, 0x00, 0x01, 0x10, 0xE5, 0x7B,
+	0x2D, 0x27, 0xD3, 0x06, 0x0C, 0xB1, 0x24, 0x27, 0x60, 0xE4, 0x27, 0xE3,
+	0x86, 0x46, 0xDF, 0x04, 0x0D, 0x27, 0xD1, 0x46, 0xB1, 0x23, 0x27, 0x5E,
+	0xE4, 0x27, 0xE5, 0x86, 0x46, 0xDF, 0x00, 0x00, 0xA1, 0x01, 0x14, 0xE5,
+	0x01, 0x0C, 0xE4, 0x86, 0x01, 0x0C, 0xDF, 0x00, 0x00, 0x53, 0x27, 0x01,
+	0x00, 0x0E, 0x06, 0x02, 0x62, 0x00, 0xD5, 0x26, 0x04, 0x73, 0x00, 0x27,
+	0xE3, 0xDF, 0x00, 0x00, 0x27, 0xE5, 0xDF, 0x00, 0x01, 0x03, 0x00, 0x43,
+	0x26, 0x27, 0x01, 0x10, 0x17, 0x06, 0x06, 0x01, 0x04, 0xE5, 0x02, 0x00,
+	0xE5, 0x27, 0x01, 0x08, 0x17, 0x06, 0x06, 0x01, 0x03, 0xE5, 0x02, 0x00,
+	0xE5, 0x27, 0x01, 0x20, 0x17, 0x06, 0x06, 0x01, 0x05, 0xE5, 0x02, 0x00,
+	0xE5, 0x27, 0x01, 0x80, 0x40, 0x17, 0x06, 0x06, 0x01, 0x06, 0xE5, 0x02,
+	0x00, 0xE5, 0x01, 0x04, 0x17, 0x06, 0x06, 0x01, 0x02, 0xE5, 0x02, 0x00,
+	0xE5, 0x00, 0x00, 0x27, 0x01, 0x08, 0x51, 0xE5, 0xE5, 0x00, 0x00, 0x27,
+	0x01, 0x10, 0x51, 0xE5, 0xE3, 0x00, 0x00, 0x27, 0x54, 0x06, 0x02, 0x26,
+	0x00, 0xD5, 0x26, 0x04, 0x76
 };
 
 static const uint16_t t0_caddr[] = {
@@ -807,80 +823,85 @@ static const uint16_t t0_caddr[] = {
 	284,
 	289,
 	294,
-	303,
-	316,
-	320,
-	345,
-	351,
-	370,
-	381,
-	422,
-	542,
-	546,
-	611,
-	626,
-	637,
-	655,
-	684,
-	694,
-	730,
-	740,
-	818,
-	832,
-	838,
-	897,
-	916,
-	951,
-	1000,
-	1076,
-	1103,
-	1134,
-	1145,
-	1497,
-	1644,
-	1668,
-	1884,
-	1898,
-	1907,
-	1911,
-	2006,
-	2027,
-	2083,
-	2090,
-	2101,
-	2117,
-	2123,
-	2134,
-	2169,
-	2181,
-	2187,
-	2202,
-	2218,
-	2411,
-	2420,
-	2433,
-	2442,
-	2449,
-	2459,
-	2565,
-	2590,
-	2603,
-	2619,
-	2637,
-	2669,
-	2703,
-	3071,
-	3107,
-	3120,
-	3134,
-	3139,
-	3144,
-	3210,
-	3218,
-	3226
+	299,
+	304,
+	309,
+	318,
+	331,
+	335,
+	360,
+	366,
+	385,
+	396,
+	437,
+	575,
+	579,
+	644,
+	659,
+	670,
+	688,
+	717,
+	727,
+	763,
+	778,
+	788,
+	866,
+	880,
+	886,
+	945,
+	964,
+	999,
+	1048,
+	1124,
+	1151,
+	1182,
+	1193,
+	1248,
+	1633,
+	1780,
+	1804,
+	2020,
+	2034,
+	2043,
+	2047,
+	2142,
+	2163,
+	2219,
+	2226,
+	2237,
+	2253,
+	2259,
+	2270,
+	2305,
+	2317,
+	2323,
+	2338,
+	2354,
+	2547,
+	2556,
+	2569,
+	2578,
+	2585,
+	2595,
+	2701,
+	2726,
+	2739,
+	2755,
+	2773,
+	2805,
+	2839,
+	3228,
+	3264,
+	3277,
+	3291,
+	3296,
+	3301,
+	3367,
+	3375,
+	3383
 };
 
-#define T0_INTERPRETED   88
+#define T0_INTERPRETED   90
 
 #define T0_ENTER(ip, rp, slot)   do { \
 		const unsigned char *t0_newip; \
@@ -901,7 +922,7 @@ name(void *ctx) \
 	T0_ENTER(t0ctx->ip, t0ctx->rp, slot); \
 }
 
-T0_DEFENTRY(br_ssl_hs_client_init_main, 169)
+T0_DEFENTRY(br_ssl_hs_client_init_main, 175)
 
 #define T0_NEXT(t0ipp)   (*(*(t0ipp)) ++)
 
@@ -1253,6 +1274,15 @@ br_ssl_hs_client_run(void *t0ctx)
 				}
 				break;
 			case 31: {
+				/* copy-session-ticket */
+
+	if (CTX->session_ticket_len > 0) {
+		memcpy(ENG->pad, CTX->session_ticket, CTX->session_ticket_len);
+	}
+
+				}
+				break;
+			case 32: {
 				/* data-get8 */
 
 	size_t addr = T0_POP();
@@ -1260,14 +1290,14 @@ br_ssl_hs_client_run(void *t0ctx)
 
 				}
 				break;
-			case 32: {
+			case 33: {
 				/* discard-input */
 
 	ENG->hlen_in = 0;
 
 				}
 				break;
-			case 33: {
+			case 34: {
 				/* do-client-sign */
 
 	size_t sig_len;
@@ -1281,7 +1311,7 @@ br_ssl_hs_client_run(void *t0ctx)
 
 				}
 				break;
-			case 34: {
+			case 35: {
 				/* do-ecdh */
 
 	unsigned prf_id = T0_POP();
@@ -1298,7 +1328,7 @@ br_ssl_hs_client_run(void *t0ctx)
 
 				}
 				break;
-			case 35: {
+			case 36: {
 				/* do-rsa-encrypt */
 
 	int x;
@@ -1313,7 +1343,7 @@ br_ssl_hs_client_run(void *t0ctx)
 
 				}
 				break;
-			case 36: {
+			case 37: {
 				/* do-static-ecdh */
 
 	unsigned prf_id = T0_POP();
@@ -1325,17 +1355,17 @@ br_ssl_hs_client_run(void *t0ctx)
 
 				}
 				break;
-			case 37: {
+			case 38: {
 				/* drop */
  (void)T0_POP(); 
 				}
 				break;
-			case 38: {
+			case 39: {
 				/* dup */
  T0_PUSH(T0_PEEK(0)); 
 				}
 				break;
-			case 39: {
+			case 40: {
 				/* ext-ALPN-length */
 
 	size_t u, len;
@@ -1352,7 +1382,7 @@ br_ssl_hs_client_run(void *t0ctx)
 
 				}
 				break;
-			case 40: {
+			case 41: {
 				/* fail */
 
 	br_ssl_engine_fail(ENG, (int)T0_POPi());
@@ -1360,14 +1390,14 @@ br_ssl_hs_client_run(void *t0ctx)
 
 				}
 				break;
-			case 41: {
+			case 42: {
 				/* flush-record */
 
 	br_ssl_engine_flush_record(ENG);
 
 				}
 				break;
-			case 42: {
+			case 43: {
 				/* get-client-chain */
 
 	uint32_t auth_types;
@@ -1389,7 +1419,7 @@ br_ssl_hs_client_run(void *t0ctx)
 
 				}
 				break;
-			case 43: {
+			case 44: {
 				/* get-key-type-usages */
 
 	const br_x509_class *xc;
@@ -1406,7 +1436,7 @@ br_ssl_hs_client_run(void *t0ctx)
 
 				}
 				break;
-			case 44: {
+			case 45: {
 				/* get16 */
 
 	size_t addr = (size_t)T0_POP();
@@ -1414,7 +1444,7 @@ br_ssl_hs_client_run(void *t0ctx)
 
 				}
 				break;
-			case 45: {
+			case 46: {
 				/* get32 */
 
 	size_t addr = (size_t)T0_POP();
@@ -1422,7 +1452,7 @@ br_ssl_hs_client_run(void *t0ctx)
 
 				}
 				break;
-			case 46: {
+			case 47: {
 				/* get8 */
 
 	size_t addr = (size_t)T0_POP();
@@ -1430,14 +1460,14 @@ br_ssl_hs_client_run(void *t0ctx)
 
 				}
 				break;
-			case 47: {
+			case 48: {
 				/* has-input? */
 
 	T0_PUSHi(-(ENG->hlen_in != 0));
 
 				}
 				break;
-			case 48: {
+			case 49: {
 				/* memcmp */
 
 	size_t len = (size_t)T0_POP();
@@ -1448,7 +1478,7 @@ br_ssl_hs_client_run(void *t0ctx)
 
 				}
 				break;
-			case 49: {
+			case 50: {
 				/* memcpy */
 
 	size_t len = (size_t)T0_POP();
@@ -1458,7 +1488,7 @@ br_ssl_hs_client_run(void *t0ctx)
 
 				}
 				break;
-			case 50: {
+			case 51: {
 				/* mkrand */
 
 	size_t len = (size_t)T0_POP();
@@ -1467,21 +1497,21 @@ br_ssl_hs_client_run(void *t0ctx)
 
 				}
 				break;
-			case 51: {
+			case 52: {
 				/* more-incoming-bytes? */
 
 	T0_PUSHi(ENG->hlen_in != 0 || !br_ssl_engine_recvrec_finished(ENG));
 
 				}
 				break;
-			case 52: {
+			case 53: {
 				/* multihash-init */
 
 	br_multihash_init(&ENG->mhash);
 
 				}
 				break;
-			case 53: {
+			case 54: {
 				/* neg */
 
 	uint32_t a = T0_POP();
@@ -1489,7 +1519,7 @@ br_ssl_hs_client_run(void *t0ctx)
 
 				}
 				break;
-			case 54: {
+			case 55: {
 				/* not */
 
 	uint32_t a = T0_POP();
@@ -1497,7 +1527,7 @@ br_ssl_hs_client_run(void *t0ctx)
 
 				}
 				break;
-			case 55: {
+			case 56: {
 				/* or */
 
 	uint32_t b = T0_POP();
@@ -1506,12 +1536,12 @@ br_ssl_hs_client_run(void *t0ctx)
 
 				}
 				break;
-			case 56: {
+			case 57: {
 				/* over */
  T0_PUSH(T0_PEEK(1)); 
 				}
 				break;
-			case 57: {
+			case 58: {
 				/* read-chunk-native */
 
 	size_t clen = ENG->hlen_in;
@@ -1535,7 +1565,7 @@ br_ssl_hs_client_run(void *t0ctx)
 
 				}
 				break;
-			case 58: {
+			case 59: {
 				/* read8-native */
 
 	if (ENG->hlen_in > 0) {
@@ -1553,7 +1583,20 @@ br_ssl_hs_client_run(void *t0ctx)
 
 				}
 				break;
-			case 59: {
+			case 60: {
+				/* save-session-ticket */
+
+	uint32_t hint = T0_POP();
+	size_t len = T0_POP();
+	if (len > 0) {
+		memcpy(CTX->session_ticket, ENG->pad, len);
+	}
+	CTX->session_ticket_len = (uint16_t)len;
+	CTX->session_ticket_lifetime = hint;
+
+				}
+				break;
+			case 61: {
 				/* set-server-curve */
 
 	const br_x509_class *xc;
@@ -1566,7 +1609,7 @@ br_ssl_hs_client_run(void *t0ctx)
 
 				}
 				break;
-			case 60: {
+			case 62: {
 				/* set16 */
 
 	size_t addr = (size_t)T0_POP();
@@ -1574,7 +1617,7 @@ br_ssl_hs_client_run(void *t0ctx)
 
 				}
 				break;
-			case 61: {
+			case 63: {
 				/* set32 */
 
 	size_t addr = (size_t)T0_POP();
@@ -1582,7 +1625,7 @@ br_ssl_hs_client_run(void *t0ctx)
 
 				}
 				break;
-			case 62: {
+			case 64: {
 				/* set8 */
 
 	size_t addr = (size_t)T0_POP();
@@ -1590,7 +1633,7 @@ br_ssl_hs_client_run(void *t0ctx)
 
 				}
 				break;
-			case 63: {
+			case 65: {
 				/* strlen */
 
 	void *str = (unsigned char *)ENG + (size_t)T0_POP();
@@ -1598,7 +1641,7 @@ br_ssl_hs_client_run(void *t0ctx)
 
 				}
 				break;
-			case 64: {
+			case 66: {
 				/* supported-curves */
 
 	uint32_t x = ENG->iec == NULL ? 0 : ENG->iec->supported_curves;
@@ -1606,7 +1649,7 @@ br_ssl_hs_client_run(void *t0ctx)
 
 				}
 				break;
-			case 65: {
+			case 67: {
 				/* supported-hash-functions */
 
 	int i;
@@ -1625,26 +1668,26 @@ br_ssl_hs_client_run(void *t0ctx)
 
 				}
 				break;
-			case 66: {
+			case 68: {
 				/* supports-ecdsa? */
 
 	T0_PUSHi(-(ENG->iecdsa != 0));
 
 				}
 				break;
-			case 67: {
+			case 69: {
 				/* supports-rsa-sign? */
 
 	T0_PUSHi(-(ENG->irsavrfy != 0));
 
 				}
 				break;
-			case 68: {
+			case 70: {
 				/* swap */
  T0_SWAP(); 
 				}
 				break;
-			case 69: {
+			case 71: {
 				/* switch-aesccm-in */
 
 	int is_client, prf_id;
@@ -1659,7 +1702,7 @@ br_ssl_hs_client_run(void *t0ctx)
 
 				}
 				break;
-			case 70: {
+			case 72: {
 				/* switch-aesccm-out */
 
 	int is_client, prf_id;
@@ -1674,7 +1717,7 @@ br_ssl_hs_client_run(void *t0ctx)
 
 				}
 				break;
-			case 71: {
+			case 73: {
 				/* switch-aesgcm-in */
 
 	int is_client, prf_id;
@@ -1688,7 +1731,7 @@ br_ssl_hs_client_run(void *t0ctx)
 
 				}
 				break;
-			case 72: {
+			case 74: {
 				/* switch-aesgcm-out */
 
 	int is_client, prf_id;
@@ -1702,7 +1745,7 @@ br_ssl_hs_client_run(void *t0ctx)
 
 				}
 				break;
-			case 73: {
+			case 75: {
 				/* switch-cbc-in */
 
 	int is_client, prf_id, mac_id, aes;
@@ -1718,7 +1761,7 @@ br_ssl_hs_client_run(void *t0ctx)
 
 				}
 				break;
-			case 74: {
+			case 76: {
 				/* switch-cbc-out */
 
 	int is_client, prf_id, mac_id, aes;
@@ -1734,7 +1777,7 @@ br_ssl_hs_client_run(void *t0ctx)
 
 				}
 				break;
-			case 75: {
+			case 77: {
 				/* switch-chapol-in */
 
 	int is_client, prf_id;
@@ -1745,7 +1788,7 @@ br_ssl_hs_client_run(void *t0ctx)
 
 				}
 				break;
-			case 76: {
+			case 78: {
 				/* switch-chapol-out */
 
 	int is_client, prf_id;
@@ -1756,7 +1799,7 @@ br_ssl_hs_client_run(void *t0ctx)
 
 				}
 				break;
-			case 77: {
+			case 79: {
 				/* test-protocol-name */
 
 	size_t len = T0_POP();
@@ -1775,7 +1818,7 @@ br_ssl_hs_client_run(void *t0ctx)
 
 				}
 				break;
-			case 78: {
+			case 80: {
 				/* total-chain-length */
 
 	size_t u;
@@ -1789,7 +1832,7 @@ br_ssl_hs_client_run(void *t0ctx)
 
 				}
 				break;
-			case 79: {
+			case 81: {
 				/* u>> */
 
 	int c = (int)T0_POPi();
@@ -1798,7 +1841,7 @@ br_ssl_hs_client_run(void *t0ctx)
 
 				}
 				break;
-			case 80: {
+			case 82: {
 				/* verify-SKE-sig */
 
 	size_t sig_len = T0_POP();
@@ -1809,7 +1852,7 @@ br_ssl_hs_client_run(void *t0ctx)
 
 				}
 				break;
-			case 81: {
+			case 83: {
 				/* write-blob-chunk */
 
 	size_t clen = ENG->hlen_out;
@@ -1833,7 +1876,7 @@ br_ssl_hs_client_run(void *t0ctx)
 
 				}
 				break;
-			case 82: {
+			case 84: {
 				/* write8-native */
 
 	unsigned char x;
@@ -1852,7 +1895,7 @@ br_ssl_hs_client_run(void *t0ctx)
 
 				}
 				break;
-			case 83: {
+			case 85: {
 				/* x509-append */
 
 	const br_x509_class *xc;
@@ -1864,7 +1907,7 @@ br_ssl_hs_client_run(void *t0ctx)
 
 				}
 				break;
-			case 84: {
+			case 86: {
 				/* x509-end-cert */
 
 	const br_x509_class *xc;
@@ -1874,7 +1917,7 @@ br_ssl_hs_client_run(void *t0ctx)
 
 				}
 				break;
-			case 85: {
+			case 87: {
 				/* x509-end-chain */
 
 	const br_x509_class *xc;
@@ -1884,7 +1927,7 @@ br_ssl_hs_client_run(void *t0ctx)
 
 				}
 				break;
-			case 86: {
+			case 88: {
 				/* x509-start-cert */
 
 	const br_x509_class *xc;
@@ -1894,7 +1937,7 @@ br_ssl_hs_client_run(void *t0ctx)
 
 				}
 				break;
-			case 87: {
+			case 89: {
 				/* x509-start-chain */
 
 	const br_x509_class *xc;
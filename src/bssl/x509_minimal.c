@@ -1206,6 +1206,30 @@ br_x509_minimal_run(void *t0ctx)
 		}
 	}
 
+	/*
+	 * Trust anchor store, looked up by the hashed issuer DN. The
+	 * returned anchor is released once the signature is checked.
+	 */
+	if (CTX->trust_anchor_dynamic != NULL) {
+		const br_x509_trust_anchor *ta;
+		int r;
+
+		ta = CTX->trust_anchor_dynamic(CTX->trust_anchor_dynamic_ctx,
+			CTX->saved_dn_hash, DNHASH_LEN);
+		if (ta != NULL) {
+			r = (ta->flags & BR_X509_TA_CA) != 0
+				&& verify_signature(CTX, &ta->pkey) == 0;
+			if (CTX->trust_anchor_dynamic_free != NULL) {
+				CTX->trust_anchor_dynamic_free(
+					CTX->trust_anchor_dynamic_ctx, ta);
+			}
+			if (r) {
+				CTX->err = BR_ERR_X509_OK;
+				T0_CO();
+			}
+		}
+	}
+
 				}
 				break;
 			case 25: {
@@ -21,8 +21,6 @@
 
 #if defined(BSSL_BUILD_INTERNAL_CORE)
 
-#if defined(ENABLE_FS)
-
 using namespace bssl;
 
 #include <memory>
@@ -39,6 +37,17 @@ using namespace bssl;
 
 namespace bssl
 {
+  class CertStoreBase
+  {
+  public:
+    virtual ~CertStoreBase() {}
+
+    // Installs the cert store into the X509 decoder (normally via static function callbacks)
+    virtual void installCertStore(br_x509_minimal_context *ctx) = 0;
+  };
+
+#if defined(ENABLE_FS)
+
   extern "C"
   {
     // Callback for the x509 decoder
@@ -49,32 +58,78 @@ namespace bssl
     }
   }
 
-  class CertStoreBase
-  {
-  public:
-    virtual ~CertStoreBase() {}
+// Trust anchors kept decoded by default, see CertStore::setCacheSize()
+#if !defined(BSSL_CERTSTORE_CACHE_SIZE)
+#define BSSL_CERTSTORE_CACHE_SIZE 0
+#endif
 
-    // Installs the cert store into the X509 decoder (normally via static function callbacks)
-    virtual void installCertStore(br_x509_minimal_context *ctx) = 0;
-  };
+// Read size used to stream the archive into the decoder when indexing
+#if !defined(BSSL_CERTSTORE_CHUNK_SIZE)
+#define BSSL_CERTSTORE_CHUNK_SIZE 256
+#endif
+
+// Index entries sorted in RAM at a time when indexing, larger archives are
+// sorted in runs of this size that are then merged
+#if !defined(BSSL_CERTSTORE_SORT_RUN)
+#define BSSL_CERTSTORE_SORT_RUN 64
+#endif
 
   class CertStore : public CertStoreBase
   {
+    // Sorted runs merged at once when indexing
+    static const size_t _mergeWays = 8;
+    static_assert(BSSL_CERTSTORE_SORT_RUN >= _mergeWays, "BSSL_CERTSTORE_SORT_RUN is below 8");
+
   public:
     CertStore() {};
     ~CertStore()
     {
       esp_sslclient_free(&_indexName);
       esp_sslclient_free(&_dataName);
+      setCacheSize(0);
+    }
+
+    // Keeps up to entries recently used trust anchors decoded in RAM (with at
+    // most maxBytes of key data when not 0), so reconnecting to the same
+    // servers needs no file access or certificate decoding. 0 (the default)
+    // disables it. From the first lookup until the store is destroyed this
+    // holds about 80 bytes per entry (32-bit targets), plus the key of each
+    // cached anchor (259 bytes for RSA-2048, 65 for EC P-256).
+    void setCacheSize(size_t entries, size_t maxBytes = 0)
+    {
+      clearCache();
+      esp_sslclient_free(&_cache);
+      _cacheSize = entries;
+      _cacheMaxBytes = maxBytes;
     }
 
+    void clearCache()
+    {
+      for (size_t i = 0; _cache && i < _cacheSize; i++)
+        _cacheRemove(_cache[i]);
+      _cacheTick = 0;
+    }
+
+    // Lookups served from the cache and from the files.
+    size_t cacheHits() const { return _cacheHits; }
+    size_t cacheMisses() const { return _cacheMisses; }
+
     // Set the file interface instances, do preprocessing
+    // The index is sorted by the DN hash so lookups are a binary search. The
+    // entries are sorted in RAM in runs of BSSL_CERTSTORE_SORT_RUN as the
+    // archive is read, and several runs are merged through a temporary file
+    // (the index name with "~" appended), so the files are only written
+    // sequentially. Memory use does not grow with the number of certificates.
     int initCertStore(FS &fs, const char *indexFileName, const char *dataFileName)
     {
       int count = 0;
       uint32_t offset = 0;
+      bool ok = true;
+      size_t runLen = 0, runs = 0;
+      IndexBuilder *builder = nullptr;
 
       _fs = &fs;
+      clearCache();
 
       // In case initCertStore called multiple times, don't leak old filenames
       esp_sslclient_free(&_indexName);
@@ -103,9 +158,13 @@ namespace bssl
         return 0;
       }
 
+      // One decoder, hash and read buffer for the whole archive
+      builder = (IndexBuilder *)esp_sslclient_malloc(sizeof(IndexBuilder));
       uint8_t magic[8];
-      if (data.read(magic, sizeof(magic)) != sizeof(magic) || memcmp(magic, "!<arch>\n", sizeof(magic)))
+      if (!builder || data.read(magic, sizeof(magic)) != sizeof(magic) || memcmp(magic, "!<arch>\n", sizeof(magic)))
       {
+        DEBUG_BSSL("CertStore::initCertStore: OOM or not an archive\n");
+        esp_sslclient_free(&builder);
         data.close();
         index.close();
         return 0;
@@ -126,30 +185,28 @@ namespace bssl
         if (1 != sscanf((char *)(fileHeader + 48), "%d", (int *)(&length)) || !length)
           break;
 
-        void *raw = esp_sslclient_malloc(length);
-        if (!raw)
-          break;
-
-        if ((int)data.read((uint8_t *)raw, length) != length)
+        // If the filename starts with "//" then this is a rename file, skip it
+        if (fileHeader[0] == '/' && fileHeader[1] == '/')
         {
-          esp_sslclient_free(&raw);
-          break;
+          if (!data.seek(offset + length, SeekSet))
+            break;
         }
-
-        // If the filename starts with "//" then this is a rename file, skip it
-        if (fileHeader[0] != '/' || fileHeader[1] != '/')
+        else
         {
-          CertStore::CertInfo ci = _preprocessCert(length, offset, raw);
-          if (index.write((uint8_t *)&ci, sizeof(ci)) != (ssize_t)sizeof(ci))
-          {
-            esp_sslclient_free(&raw);
+          if (!_preprocessCert(data, length, offset, builder, builder->run[runLen]))
             break;
-          }
           count++;
+          if (++runLen == BSSL_CERTSTORE_SORT_RUN)
+          {
+            runs++;
+            ok = _writeRun(index, builder->run, runLen);
+            runLen = 0;
+            if (!ok)
+              break;
+          }
         }
 
         offset += length;
-        esp_sslclient_free(&raw);
         if (offset & 1)
         {
           uint8_t x;
@@ -158,8 +215,17 @@ namespace bssl
         }
       }
       data.close();
+      if (ok && runLen > 0)
+      {
+        runs++;
+        ok = _writeRun(index, builder->run, runLen);
+      }
       index.close();
-      return count;
+
+      if (ok && runs > 1)
+        ok = _mergeRuns(count, builder->run);
+      esp_sslclient_free(&builder);
+      return ok ? count : 0;
     }
 
     // Installs the cert store into the X509 decoder (normally via static function callbacks)
@@ -169,68 +235,141 @@ namespace bssl
     }
 
   protected:
+    // A decoded trust anchor, the key data is allocated in one block
+    class CachedTA
+    {
+    public:
+      uint8_t sha256[32];
+      uint32_t tick; // LRU stamp, 0 for an unused entry
+      size_t bytes;
+      uint8_t *key;
+      br_x509_trust_anchor ta;
+    };
+
     FS *_fs = nullptr;
     char *_indexName = nullptr;
     char *_dataName = nullptr;
     X509List *_x509 = nullptr;
 
+    // The binary format of the index file
+    class CertInfo
+    {
+    public:
+      uint8_t sha256[32];
+      uint32_t offset;
+      uint32_t length;
+    };
+
+    // Working state of initCertStore(), allocated once per call
+    class IndexBuilder
+    {
+    public:
+      br_x509_decoder_context decoder;
+      br_sha256_context sha256;
+      uint8_t chunk[BSSL_CERTSTORE_CHUNK_SIZE];
+      CertInfo run[BSSL_CERTSTORE_SORT_RUN];
+    };
+
+    CachedTA *_cache = nullptr;
+    size_t _cacheSize = BSSL_CERTSTORE_CACHE_SIZE;
+    size_t _cacheMaxBytes = 0;
+    size_t _cacheBytes = 0;
+    uint32_t _cacheTick = 0;
+    size_t _cacheHits = 0;
+    size_t _cacheMisses = 0;
+
     // These need to be static as they are callbacks from BearSSL C code
     static const br_x509_trust_anchor *findHashedTA(void *ctx, void *hashed_dn, size_t len)
     {
       CertStore *cs = static_cast<CertStore *>(ctx);
-      CertStore::CertInfo ci;
+      CertStore::CertInfo ci = {}, entry;
 
       if (!cs || len != sizeof(ci.sha256) || !cs->_indexName || !cs->_dataName || !cs->_fs)
         return nullptr;
 
+      const br_x509_trust_anchor *cached = cs->_cacheFind((const uint8_t *)hashed_dn);
+      if (cached)
+      {
+        cs->_cacheHits++;
+        return cached;
+      }
+      cs->_cacheMisses++;
+
       File index = cs->_fs->open(cs->_indexName, FILE_READ);
       if (!index)
         return nullptr;
 
-      while (index.read((uint8_t *)&ci, sizeof(ci)) == sizeof(ci))
+      // Binary search for the first entry not below hashed_dn
+      size_t lo = 0, hi = index.size() / sizeof(ci);
+      bool found = false;
+      while (lo < hi)
       {
-        if (!memcmp(ci.sha256, hashed_dn, sizeof(ci.sha256)))
+        size_t mid = (lo + hi) / 2;
+        if (!index.seek(mid * sizeof(entry), SeekSet) || index.read((uint8_t *)&entry, sizeof(entry)) != sizeof(entry))
+          break;
+        int cmp = memcmp(entry.sha256, hashed_dn, sizeof(entry.sha256));
+        if (cmp < 0)
+          lo = mid + 1;
+        else
+          hi = mid;
+        // The last match read is the first entry with that hash
+        if (cmp == 0)
         {
-          index.close();
-          uint8_t *der = (uint8_t *)esp_sslclient_malloc(ci.length);
-          if (!der)
-            return nullptr;
+          ci = entry;
+          found = true;
+        }
+      }
+      index.close();
 
-          File data = cs->_fs->open(cs->_dataName, FILE_READ);
-          if (!data)
-          {
-            esp_sslclient_free(&der);
-            return nullptr;
-          }
-          if (!data.seek(ci.offset, SeekSet))
-          {
-            data.close();
-            esp_sslclient_free(&der);
-            return nullptr;
-          }
-          if ((int)data.read(der, ci.length) != (int)ci.length)
-          {
-            esp_sslclient_free(&der);
-            return nullptr;
-          }
-          data.close();
-          cs->_x509 = new (std::nothrow) X509List(der, ci.length);
-          esp_sslclient_free(&der);
-          if (!cs->_x509)
-          {
-            DEBUG_BSSL("CertStore::findHashedTA: OOM\n");
-            return nullptr;
-          }
+      if (!found)
+        return nullptr;
 
-          br_x509_trust_anchor *ta = (br_x509_trust_anchor *)cs->_x509->getTrustAnchors();
-          memcpy(ta->dn.data, ci.sha256, sizeof(ci.sha256));
-          ta->dn.len = sizeof(ci.sha256);
+      uint8_t *der = (uint8_t *)esp_sslclient_malloc(ci.length);
+      if (!der)
+        return nullptr;
 
-          return ta;
-        }
+      File data = cs->_fs->open(cs->_dataName, FILE_READ);
+      if (!data)
+      {
+        esp_sslclient_free(&der);
+        return nullptr;
       }
-      index.close();
-      return nullptr;
+      if (!data.seek(ci.offset, SeekSet))
+      {
+        data.close();
+        esp_sslclient_free(&der);
+        return nullptr;
+      }
+      if ((int)data.read(der, ci.length) != (int)ci.length)
+      {
+        esp_sslclient_free(&der);
+        return nullptr;
+      }
+      data.close();
+      cs->_x509 = new (std::nothrow) X509List(der, ci.length);
+      esp_sslclient_free(&der);
+      if (!cs->_x509)
+      {
+        DEBUG_BSSL("CertStore::findHashedTA: OOM\n");
+        return nullptr;
+      }
+
+      br_x509_trust_anchor *ta = (br_x509_trust_anchor *)cs->_x509->getTrustAnchors();
+      if (!ta)
+        return nullptr;
+      memcpy(ta->dn.data, ci.sha256, sizeof(ci.sha256));
+      ta->dn.len = sizeof(ci.sha256);
+
+      // The cache keeps its own copy of the key, the certificate is done with
+      cached = cs->_cacheInsert(ci.sha256, ta);
+      if (cached)
+      {
+        delete cs->_x509;
+        cs->_x509 = nullptr;
+        return cached;
+      }
+
+      return ta;
     }
 
     static void freeHashedTA(void *ctx, const br_x509_trust_anchor *ta)
@@ -241,57 +380,226 @@ namespace bssl
       cs->_x509 = nullptr;
     }
 
-    // The binary format of the index file
-    class CertInfo
+    const br_x509_trust_anchor *_cacheFind(const uint8_t *sha256)
     {
-    public:
-      uint8_t sha256[32];
-      uint32_t offset;
-      uint32_t length;
-    };
-    
-    static CertInfo _preprocessCert(uint32_t length, uint32_t offset, const void *raw)
+      for (size_t i = 0; _cache && i < _cacheSize; i++)
+      {
+        if (_cache[i].tick > 0 && !memcmp(_cache[i].sha256, sha256, sizeof(_cache[i].sha256)))
+        {
+          _cache[i].tick = ++_cacheTick;
+          return &_cache[i].ta;
+        }
+      }
+      return nullptr;
+    }
+
+    // Copies the trust anchor into the cache, evicting the least recently
+    // used entries as needed. Returns the cached copy, or nullptr.
+    const br_x509_trust_anchor *_cacheInsert(const uint8_t *sha256, const br_x509_trust_anchor *ta)
     {
-      CertStore::CertInfo ci;
+      size_t bytes;
+      if (ta->pkey.key_type == BR_KEYTYPE_RSA)
+        bytes = ta->pkey.key.rsa.nlen + ta->pkey.key.rsa.elen;
+      else if (ta->pkey.key_type == BR_KEYTYPE_EC)
+        bytes = ta->pkey.key.ec.qlen;
+      else
+        return nullptr;
+
+      if (_cacheSize == 0 || (_cacheMaxBytes > 0 && bytes > _cacheMaxBytes))
+        return nullptr;
+
+      if (!_cache)
+      {
+        _cache = (CachedTA *)esp_sslclient_malloc(_cacheSize * sizeof(CachedTA));
+        if (!_cache)
+          return nullptr;
+        memset(_cache, 0, _cacheSize * sizeof(CachedTA));
+      }
+
+      // Evict until there is a free entry and room for the key
+      CachedTA *e = nullptr;
+      while (true)
+      {
+        CachedTA *lru = nullptr;
+        e = nullptr;
+        for (size_t i = 0; i < _cacheSize; i++)
+        {
+          if (_cache[i].tick == 0)
+            e = e ? e : &_cache[i];
+          else if (!lru || _cache[i].tick < lru->tick)
+            lru = &_cache[i];
+        }
+        if (e && (_cacheMaxBytes == 0 || _cacheBytes + bytes <= _cacheMaxBytes))
+          break;
+        _cacheRemove(*lru);
+      }
+
+      e->key = (uint8_t *)esp_sslclient_malloc(bytes);
+      if (!e->key)
+        return nullptr;
 
+      memcpy(e->sha256, sha256, sizeof(e->sha256));
+      e->ta = *ta;
+      e->ta.dn.data = e->sha256;
+      e->ta.dn.len = sizeof(e->sha256);
+      if (ta->pkey.key_type == BR_KEYTYPE_RSA)
+      {
+        memcpy(e->key, ta->pkey.key.rsa.n, ta->pkey.key.rsa.nlen);
+        memcpy(e->key + ta->pkey.key.rsa.nlen, ta->pkey.key.rsa.e, ta->pkey.key.rsa.elen);
+        e->ta.pkey.key.rsa.n = e->key;
+        e->ta.pkey.key.rsa.e = e->key + ta->pkey.key.rsa.nlen;
+      }
+      else
+      {
+        memcpy(e->key, ta->pkey.key.ec.q, ta->pkey.key.ec.qlen);
+        e->ta.pkey.key.ec.q = e->key;
+      }
+      e->bytes = bytes;
+      e->tick = ++_cacheTick;
+      _cacheBytes += bytes;
+      return &e->ta;
+    }
+
+    void _cacheRemove(CachedTA &e)
+    {
+      if (e.tick == 0)
+        return;
+      esp_sslclient_free(&e.key);
+      _cacheBytes -= e.bytes;
+      e.tick = 0;
+    }
+
+    // Index order: by hash, then archive offset so certificates with the
+    // same subject keep their archive order.
+    static bool _infoLess(const CertInfo &a, const CertInfo &b)
+    {
+      int cmp = memcmp(a.sha256, b.sha256, sizeof(a.sha256));
+      return cmp < 0 || (cmp == 0 && a.offset < b.offset);
+    }
+
+    // Sorts the len entries of a run and appends them to the index.
+    static bool _writeRun(File &index, CertInfo *run, size_t len)
+    {
+      for (size_t i = 1; i < len; i++)
+      {
+        CertInfo ci = run[i];
+        size_t j = i;
+        for (; j > 0 && _infoLess(ci, run[j - 1]); j--)
+          run[j] = run[j - 1];
+        run[j] = ci;
+      }
+      return index.write((const uint8_t *)run, len * sizeof(CertInfo)) == len * sizeof(CertInfo);
+    }
+
+    // Merges each group of _mergeWays sorted runs of runLen entries of in into
+    // one run of out. buf holds the next entries of each run of the group.
+    static bool _mergePass(File &in, File &out, size_t count, size_t runLen, CertInfo *buf)
+    {
+      const size_t per = BSSL_CERTSTORE_SORT_RUN / _mergeWays;
+      for (size_t first = 0; first < count; first += runLen * _mergeWays)
+      {
+        size_t next[_mergeWays], end[_mergeWays], head[_mergeWays], fill[_mergeWays];
+        size_t ways = 0;
+        for (; ways < _mergeWays && first + ways * runLen < count; ways++)
+        {
+          next[ways] = first + ways * runLen;
+          end[ways] = next[ways] + runLen < count ? next[ways] + runLen : count;
+          head[ways] = fill[ways] = 0;
+        }
+
+        while (true)
+        {
+          size_t best = ways;
+          for (size_t w = 0; w < ways; w++)
+          {
+            if (head[w] == fill[w])
+            {
+              if (next[w] == end[w])
+                continue;
+              fill[w] = end[w] - next[w] < per ? end[w] - next[w] : per;
+              if (!in.seek(next[w] * sizeof(CertInfo), SeekSet) ||
+                  in.read((uint8_t *)&buf[w * per], fill[w] * sizeof(CertInfo)) != fill[w] * sizeof(CertInfo))
+                return false;
+              next[w] += fill[w];
+              head[w] = 0;
+            }
+            if (best == ways || _infoLess(buf[w * per + head[w]], buf[best * per + head[best]]))
+              best = w;
+          }
+          if (best == ways)
+            break;
+          if (out.write((const uint8_t *)&buf[best * per + head[best]++], sizeof(CertInfo)) != sizeof(CertInfo))
+            return false;
+        }
+      }
+      return true;
+    }
+
+    // Merges the sorted runs of the index, alternating between the index and
+    // the temporary file, and leaves the result in the index.
+    bool _mergeRuns(size_t count, CertInfo *buf)
+    {
+      const size_t nameLen = strlen(_indexName);
+      char *tmpName = (char *)esp_sslclient_malloc(nameLen + 2);
+      if (!tmpName)
+        return false;
+      memcpy(tmpName, _indexName, nameLen);
+      tmpName[nameLen] = '~';
+      tmpName[nameLen + 1] = 0;
+
+      const char *src = _indexName, *dst = tmpName;
+      bool ok = true;
+      for (size_t runLen = BSSL_CERTSTORE_SORT_RUN; ok && runLen < count; runLen *= _mergeWays)
+      {
+        File in = _fs->open(src, FILE_READ);
+        File out = _fs->open(dst, FILE_WRITE);
+        ok = in && out && _mergePass(in, out, count, runLen, buf);
+        in.close();
+        out.close();
+        const char *t = src;
+        src = dst;
+        dst = t;
+      }
+
+      if (ok && src == tmpName)
+        ok = _fs->remove(_indexName) && _fs->rename(tmpName, _indexName);
+      else
+        _fs->remove(tmpName);
+      esp_sslclient_free(&tmpName);
+      return ok;
+    }
+
+    // Hashes the subject DN of the length bytes certificate at the current
+    // position of data, which is fed to the decoder one chunk at a time.
+    static bool _preprocessCert(File &data, uint32_t length, uint32_t offset, IndexBuilder *builder, CertInfo &ci)
+    {
       // Clear the CertInfo
       memset(&ci, 0, sizeof(ci));
 
       // Process it using SHA256, same as the hashed_dn
-      br_x509_decoder_context *ctx = new (std::nothrow) br_x509_decoder_context;
-      br_sha256_context *sha256 = new (std::nothrow) br_sha256_context;
-      if (!ctx || !sha256)
+      br_sha256_init(&builder->sha256);
+      br_x509_decoder_init(&builder->decoder, dn_append, &builder->sha256);
+      for (uint32_t left = length; left > 0;)
       {
-        if (ctx)
-          delete ctx;
-        if (sha256)
-          delete sha256;
-        DEBUG_BSSL("CertStore::_preprocessCert: OOM\n");
-        return ci;
+        size_t len = left < sizeof(builder->chunk) ? left : sizeof(builder->chunk);
+        if ((size_t)data.read(builder->chunk, len) != len)
+          return false;
+        br_x509_decoder_push(&builder->decoder, builder->chunk, len);
+        left -= len;
       }
 
-      br_sha256_init(sha256);
-      br_x509_decoder_init(ctx, dn_append, sha256);
-      br_x509_decoder_push(ctx, (const void *)raw, length);
-
       // Copy result to structure
-      br_sha256_out(sha256, &ci.sha256);
+      br_sha256_out(&builder->sha256, &ci.sha256);
       ci.length = length;
       ci.offset = offset;
-
-      // Clean up allocated memory
-      delete sha256;
-      delete ctx;
-
-      // Return result
-      return ci;
+      return true;
     }
   };
 
-};
-
 #endif
 
+};
+
 #endif
 
 #endif
@@ -0,0 +1,210 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Suwatchai K. <suwatchai@outlook.com>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef BSSL_CONNECTION_POOL_H
+#define BSSL_CONNECTION_POOL_H
+
+#if defined(BSSL_BUILD_PLATFORM_CORE) || defined(BSSL_BUILD_INTERNAL_CORE)
+
+#if !defined(BSSL_CONNECTION_POOL_SIZE)
+#define BSSL_CONNECTION_POOL_SIZE 4
+#endif
+
+// Keeps idle connections (with their SSL engine and buffers) open per host
+// and port, so repeated requests to the same server skip the TCP connect and
+// the TLS handshake.
+//
+// The pool does not own the clients. Each one is added already configured
+// (network client, trust anchors, buffer sizes, ...) and is handed out by
+// acquire() and returned by release().
+class BSSL_ConnectionPool
+{
+public:
+    BSSL_ConnectionPool() {}
+
+    ~BSSL_ConnectionPool() {}
+
+    // Adds a configured client as a pool slot.
+    bool add(BSSL_TCPClient *client)
+    {
+        if (!client || _count >= BSSL_CONNECTION_POOL_SIZE)
+            return false;
+
+        for (size_t i = 0; i < _count; i++)
+        {
+            if (_slots[i].client == client)
+                return false;
+        }
+
+        slot_t &s = _slots[_count++];
+        s.client = client;
+        s.host[0] = '\0';
+        s.port = 0;
+        s.in_use = false;
+        s.last_used = 0;
+        return true;
+    }
+
+    // Returns a client connected to host:port, reusing an idle connection to
+    // the same server when it's still alive, or nullptr if all slots are in use
+    // or the connection failed.
+    BSSL_TCPClient *acquire(const char *host, uint16_t port)
+    {
+        if (!host || strlen(host) >= sizeof(_slots[0].host))
+            return nullptr;
+
+        int free_slot = -1;
+        for (size_t i = 0; i < _count; i++)
+        {
+            slot_t &s = _slots[i];
+            if (s.in_use)
+                continue;
+
+            if (s.port == port && strcmp(s.host, host) == 0)
+            {
+                if (mAlive(s))
+                {
+                    s.in_use = true;
+                    _reused++;
+                    return s.client;
+                }
+                mClose(s);
+            }
+
+            if (free_slot < 0 || mEvictBefore(s, _slots[free_slot]))
+                free_slot = i;
+        }
+
+        if (free_slot < 0)
+            return nullptr;
+
+        slot_t &s = _slots[free_slot];
+        mClose(s);
+
+        if (!s.client->connect(host, port))
+        {
+            s.client->stop();
+            return nullptr;
+        }
+
+        strcpy(s.host, host);
+        s.port = port;
+        s.in_use = true;
+        _opened++;
+        return s.client;
+    }
+
+    // Returns the client to the pool. The connection is kept for the next
+    // acquire() unless keepAlive is false, the server closed it, or unread
+    // data is left that would be mixed into the next response.
+    void release(BSSL_TCPClient *client, bool keepAlive = true)
+    {
+        for (size_t i = 0; i < _count; i++)
+        {
+            slot_t &s = _slots[i];
+            if (s.client != client)
+                continue;
+
+            s.in_use = false;
+            s.last_used = millis();
+            if (!keepAlive || !mAlive(s))
+                mClose(s);
+            return;
+        }
+    }
+
+    // Idle connections older than this are closed instead of reused,
+    // 0 (default) keeps them until the server closes them. Connections past
+    // the session timeout of their client (setSessionTimeout) are never reused.
+    void setIdleTimeout(unsigned long timeoutMs) { _idle_timeout_ms = timeoutMs; }
+
+    // Closes all idle connections.
+    void clear()
+    {
+        for (size_t i = 0; i < _count; i++)
+        {
+            if (!_slots[i].in_use)
+                mClose(_slots[i]);
+        }
+    }
+
+    size_t size() const { return _count; }
+
+    // Number of idle slots that still hold an open connection.
+    size_t idle() const
+    {
+        size_t n = 0;
+        for (size_t i = 0; i < _count; i++)
+        {
+            if (!_slots[i].in_use && _slots[i].port > 0)
+                n++;
+        }
+        return n;
+    }
+
+    // Number of acquire() calls served by an idle connection.
+    size_t reused() const { return _reused; }
+
+    // Number of new connections made by acquire().
+    size_t opened() const { return _opened; }
+
+private:
+    struct slot_t
+    {
+        BSSL_TCPClient *client;
+        char host[64];
+        uint16_t port;
+        bool in_use;
+        unsigned long last_used;
+    };
+
+    // Closed slots are taken first, then the least recently used connection.
+    static bool mEvictBefore(const slot_t &a, const slot_t &b)
+    {
+        if ((a.port == 0) != (b.port == 0))
+            return a.port == 0;
+        return a.last_used < b.last_used;
+    }
+
+    bool mAlive(slot_t &s)
+    {
+        if (s.port == 0)
+            return false;
+
+        if (_idle_timeout_ms > 0 && millis() - s.last_used > _idle_timeout_ms)
+            return false;
+
+        // Past the client's session timeout the next write would reconnect
+        // on its own, or fail, so the slot is reconnected here instead.
+        if (s.client->sessionExpired())
+            return false;
+
+        // available() processes a pending close_notify or alert,
+        // and data left over from the last user makes the connection unusable.
+        if (s.client->available() > 0)
+            return false;
+
+        return s.client->connected();
+    }
+
+    void mClose(slot_t &s)
+    {
+        if (s.port > 0 || s.client->connected())
+            s.client->stop();
+        s.host[0] = '\0';
+        s.port = 0;
+    }
+
+    slot_t _slots[BSSL_CONNECTION_POOL_SIZE];
+    size_t _count = 0;
+    size_t _reused = 0;
+    size_t _opened = 0;
+    unsigned long _idle_timeout_ms = 0;
+};
+
+#endif
+
+#endif
@@ -97,10 +97,23 @@ namespace key_bssl
     static void free_ta_contents(br_x509_trust_anchor *ta);
     static void free_public_key(public_key *pk);
     static void free_private_key(private_key *sk);
+
+    // Scratch BearSSL decoder contexts, taken from the library allocator and
+    // freed on scope exit.
+    template <typename T>
+    struct allocator_delete
+    {
+        void operator()(T *ptr) const { esp_sslclient_free(&ptr); }
+    };
+
+    template <typename T>
+    using scratch_ptr = ReadyUtils::unique_ptr<T, allocator_delete<T>>;
+
+    template <typename T>
+    static T *scratch_new() { return reinterpret_cast<T *>(esp_sslclient_malloc(sizeof(T))); }
     static bool looks_like_DER(const unsigned char *buf, size_t len);
     static pem_object *decode_pem(const void *src, size_t len, size_t *num);
-    static void free_pem_object_contents(pem_object *po);
-    static char *strdupImpl(const char *s);
+    static void free_pem_object(pem_object *pos);
 
     // Used as callback multiple places to append a string to a vector
     static void byte_vector_append(void *ctx, const void *buff, size_t len)
@@ -115,9 +128,11 @@ namespace key_bssl
 
     static bool certificate_to_trust_anchor_inner(br_x509_trust_anchor *ta, const br_x509_certificate *xc)
     {
-        ReadyUtils::unique_ptr<br_x509_decoder_context> dc(new br_x509_decoder_context); // auto-delete on exit
+        scratch_ptr<br_x509_decoder_context> dc(scratch_new<br_x509_decoder_context>()); // auto-free on exit
         Vector<uint8_t> vdn;
         br_x509_pkey *pk;
+        if (!dc.get())
+            return false;
 
         // Clear everything in the Trust Anchor
         memset(ta, 0, sizeof(*ta));
@@ -245,48 +260,200 @@ namespace key_bssl
         }
     }
 
-    static void free_pem_object_contents(pem_object *po)
+    // Upper bounds of what decode_pem() gets out of a PEM source, so that it
+    // can allocate once: the number of BEGIN lines, the bytes of their names
+    // and the bytes all base64 characters decode to. The source may be in
+    // PROGMEM.
+    static void pem_measure(const unsigned char *buff, size_t len, size_t *objs, size_t *names, size_t *data)
     {
-        if (po)
+        static const char begin[] = "-----BEGIN ";
+        const size_t begin_len = sizeof(begin) - 1;
+        size_t b64 = 0;
+
+        *objs = 0;
+        *names = 0;
+        for (size_t i = 0; i < len; i++)
         {
-            esp_sslclient_free(&po->name);
-            esp_sslclient_free(&po->data);
+            const unsigned char c = pgm_read_byte(buff + i);
+            if ((c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z') || (c >= '0' && c <= '9') || c == '+' || c == '/')
+                b64++;
+            else if (c == '-' && len - i > begin_len)
+            {
+                size_t k = 1;
+                while (k < begin_len && tolower(pgm_read_byte(buff + i + k)) == tolower(begin[k]))
+                    k++;
+                if (k < begin_len)
+                    continue;
+                // the name is at most the rest of the line
+                size_t j = i + begin_len;
+                while (j < len && pgm_read_byte(buff + j) != '\n')
+                    j++;
+                (*objs)++;
+                *names += j - i - begin_len + 1;
+                i = j - 1;
+            }
         }
+        *data = b64 / 4 * 3 + 3 * (*objs + 1);
     }
 
-    static char *strdupImpl(const char *s)
+    // The block decode_pem() fills: the objects (plus the null terminator),
+    // then their data, then their names.
+    class pem_block
     {
-        size_t slen = strlen(s);
-        char *result = reinterpret_cast<char *>(esp_sslclient_malloc(slen + 1));
-        if (!result)
-            return NULL;
-        memcpy(result, s, slen + 1);
-        return result;
+    public:
+        pem_object *pos;
+        size_t max_objs;
+        size_t count;
+        unsigned char *data;
+        size_t data_len;
+        size_t data_cap;
+        char *names;
+        size_t names_len;
+        size_t names_cap;
+        bool overflow;
+    };
+
+    static void pem_block_reset(pem_block *b)
+    {
+        memset(b->pos, 0, (b->max_objs + 1) * sizeof(pem_object));
+        b->count = 0;
+        b->data_len = 0;
+        b->names_len = 0;
+        b->overflow = false;
     }
 
-    // Converts a PEM (~=base64) source into a set of DER-encoded binary blobs.
-    // Each blob is named by the ---- BEGIN xxx ---- field, and multiple
-    // blobs may be returned.
-    static pem_object *decode_pem(const void *src, size_t len, size_t *num)
+    // Starts the next object, its data follows the previous one. The name may
+    // be in PROGMEM.
+    static bool pem_block_begin(pem_block *b, const char *name, size_t name_len)
     {
-        Vector<pem_object> pem_list;
-        ReadyUtils::unique_ptr<br_pem_decoder_context> pc(new br_pem_decoder_context); // auto-delete on exit
-        if (!pc.get())
-            return nullptr;
+        if (b->count == b->max_objs || name_len + 1 > b->names_cap - b->names_len)
+            return false;
+        pem_object &po = b->pos[b->count];
+        po.name = b->names + b->names_len;
+        memcpy_P(po.name, name, name_len);
+        po.name[name_len] = 0;
+        b->names_len += name_len + 1;
+        po.data = b->data + b->data_len;
+        return true;
+    }
 
-        pem_object po, *pos = nullptr;
-        const unsigned char *buff = nullptr;
-        Vector<uint8_t> bv;
+    static void pem_block_end(pem_block *b)
+    {
+        pem_object &po = b->pos[b->count++];
+        po.data_len = b->data + b->data_len - po.data;
+    }
+
+    // PEM decoder destination, appends to the current object.
+    static void pem_block_append(void *ctx, const void *buff, size_t len)
+    {
+        pem_block *b = static_cast<pem_block *>(ctx);
+        if (len > b->data_cap - b->data_len)
+        {
+            b->overflow = true;
+            return;
+        }
+        memcpy(b->data + b->data_len, buff, len);
+        b->data_len += len;
+    }
+
+    // Value of a base64 character, -1 for '=' and -2 for any other character,
+    // without branches or tables on the character (as BearSSL does, since
+    // private keys go through here too).
+    static int pem_base64_value(uint32_t c)
+    {
+        const uint32_t p = c - 0x41, q = c - 0x61, r = c - 0x30;
+        const uint32_t z = ((p + 2) & -(uint32_t)(p < 26)) | ((q + 28) & -(uint32_t)(q < 26)) | ((r + 54) & -(uint32_t)(r < 10)) |
+                           (64 & -(uint32_t)(c == 0x2B)) | (65 & -(uint32_t)(c == 0x2F)) | (uint32_t)(c == 0x3D);
+        return (int)z - 2;
+    }
+
+    // Decodes the usual PEM layout, banner lines and base64 lines of whole
+    // quartets, directly into the block. Returns false on anything else so the
+    // caller can run the BearSSL decoder, which handles every variant. The
+    // source may be in PROGMEM, so it is only read with pgm_read_byte and the
+    // _P functions.
+    static bool pem_decode_lines(const unsigned char *buff, size_t len, pem_block *b)
+    {
+        bool inobj = false, padded = false;
+        size_t i = 0;
+        while (i < len)
+        {
+            size_t eol = i;
+            while (eol < len && pgm_read_byte(buff + eol) != '\n')
+                eol++;
+            const unsigned char *line = buff + i;
+            size_t n = eol - i;
+            if (n > 0 && pgm_read_byte(line + n - 1) == '\r')
+                n--;
+            i = eol + 1;
+
+            if (!inobj)
+            {
+                if (n < 5 || memcmp_P("-----", line, 5))
+                    continue; // text between objects is skipped
+                if (n <= 11 || memcmp_P("-----BEGIN ", line, 11))
+                    return false;
+                size_t name_len = n - 11;
+                while (name_len > 0 && pgm_read_byte(line + 11 + name_len - 1) == '-')
+                    name_len--;
+                for (size_t k = 0; k < name_len; k++)
+                {
+                    const unsigned char c = pgm_read_byte(line + 11 + k);
+                    if (c < 0x20 || (c >= 'a' && c <= 'z'))
+                        return false;
+                }
+                if (name_len == 0 || name_len > 127 || !pem_block_begin(b, reinterpret_cast<const char *>(line + 11), name_len))
+                    return false;
+                inobj = true;
+                padded = false;
+            }
+            else if (n >= 9 && !memcmp_P("-----END ", line, 9))
+            {
+                pem_block_end(b);
+                inobj = false;
+            }
+            else if (n > 0)
+            {
+                if (padded || n % 4 || n / 4 * 3 > b->data_cap - b->data_len)
+                    return false;
+                unsigned char *out = b->data + b->data_len;
+                for (size_t k = 0; k < n; k += 4)
+                {
+                    const int v0 = pem_base64_value(pgm_read_byte(line + k)), v1 = pem_base64_value(pgm_read_byte(line + k + 1));
+                    const int v2 = pem_base64_value(pgm_read_byte(line + k + 2)), v3 = pem_base64_value(pgm_read_byte(line + k + 3));
+                    if ((v0 | v1) < 0 || v2 < -1 || v3 < -1 || (v2 < 0 && v3 >= 0))
+                        return false;
+                    const uint32_t acc = ((uint32_t)v0 << 18) | ((uint32_t)v1 << 12) | ((uint32_t)(v2 < 0 ? 0 : v2) << 6) | (uint32_t)(v3 < 0 ? 0 : v3);
+                    *out++ = acc >> 16;
+                    if (v2 >= 0)
+                        *out++ = acc >> 8;
+                    if (v3 >= 0)
+                        *out++ = acc;
+                    if (v3 < 0)
+                    {
+                        // the padding ends the object and unused bits must be 0
+                        if (k + 4 != n || (acc & (v2 < 0 ? 0xffff : 0xff)))
+                            return false;
+                        padded = true;
+                    }
+                }
+                b->data_len = out - b->data;
+            }
+        }
+        return !inobj;
+    }
+
+    // Runs the BearSSL PEM decoder over the source into the block.
+    static bool pem_decode_bearssl(const unsigned char *buff, size_t len, pem_block *b)
+    {
+        scratch_ptr<br_pem_decoder_context> pc(scratch_new<br_pem_decoder_context>()); // auto-free on exit
+        if (!pc.get())
+            return false;
 
-        *num = 0;
-        br_pem_decoder_init(pc.get());
-        buff = reinterpret_cast<const unsigned char *>(src);
-        po.name = nullptr;
-        po.data = nullptr;
-        po.data_len = 0;
         bool inobj = false;
         bool extra_nl = true;
 
+        br_pem_decoder_init(pc.get());
         while (len > 0)
         {
             size_t tlen;
@@ -297,38 +464,25 @@ namespace key_bssl
             switch (br_pem_decoder_event(pc.get()))
             {
             case BR_PEM_BEGIN_OBJ:
-                po.name = strdupImpl(br_pem_decoder_name(pc.get()));
-                br_pem_decoder_setdest(pc.get(), byte_vector_append, &bv);
+            {
+                const char *name = br_pem_decoder_name(pc.get());
+                if (!pem_block_begin(b, name, strlen(name)))
+                    return false;
+                br_pem_decoder_setdest(pc.get(), pem_block_append, b);
                 inobj = true;
                 break;
+            }
 
             case BR_PEM_END_OBJ:
                 if (inobj)
                 {
-                    // Stick data into the vector
-                    po.data = reinterpret_cast<uint8_t *>(esp_sslclient_malloc(bv.size()));
-                    if (po.data)
-                    {
-                        memcpy(po.data, &bv[0], bv.size());
-                        po.data_len = bv.size();
-                        pem_list.push_back(po);
-                    }
-                    // Clean up state for next blob processing
-                    bv.clear();
-                    po.name = nullptr;
-                    po.data = nullptr;
-                    po.data_len = 0;
+                    pem_block_end(b);
                     inobj = false;
                 }
                 break;
 
             case BR_PEM_ERROR:
-                esp_sslclient_free(&po.name);
-                for (size_t i = 0; i < pem_list.size(); i++)
-                {
-                    free_pem_object_contents(&pem_list[i]);
-                }
-                return nullptr;
+                return false;
 
             default:
                 // Do nothing here, the parser is still working on things
@@ -342,38 +496,63 @@ namespace key_bssl
                 len = 1;
             }
         }
+        return !inobj && !b->overflow;
+    }
 
-        if (inobj)
-        {
-            esp_sslclient_free(&po.name);
-            for (size_t i = 0; i < pem_list.size(); i++)
-            {
-                free_pem_object_contents(&pem_list[i]);
-            }
+    // Converts a PEM (~=base64) source into a set of DER-encoded binary blobs.
+    // Each blob is named by the ---- BEGIN xxx ---- field, and multiple
+    // blobs may be returned. The objects, their data and their names are
+    // decoded in a single pass into one block sized up front from the source,
+    // which is freed with free_pem_object().
+    static pem_object *decode_pem(const void *src, size_t len, size_t *num)
+    {
+        const unsigned char *buff = reinterpret_cast<const unsigned char *>(src);
+        size_t max_objs = 0, names_cap = 0, data_cap = 0;
+
+        *num = 0;
+        pem_measure(buff, len, &max_objs, &names_cap, &data_cap);
+
+        const size_t head_len = (max_objs + 1) * sizeof(pem_object);
+        pem_object *pos = reinterpret_cast<pem_object *>(esp_sslclient_malloc(head_len + data_cap + names_cap));
+        if (!pos)
             return nullptr;
-        }
 
-        pos = reinterpret_cast<pem_object *>(esp_sslclient_malloc((1 + pem_list.size()) * sizeof(*pos)));
-        if (pos)
+        pem_block b;
+        b.pos = pos;
+        b.max_objs = max_objs;
+        b.data = reinterpret_cast<unsigned char *>(pos) + head_len;
+        b.data_cap = data_cap;
+        b.names = reinterpret_cast<char *>(b.data + data_cap);
+        b.names_cap = names_cap;
+        pem_block_reset(&b);
+
+        bool ok = pem_decode_lines(buff, len, &b);
+        if (!ok)
+        {
+            pem_block_reset(&b);
+            ok = pem_decode_bearssl(buff, len, &b);
+        }
+        if (!ok)
         {
-            *num = pem_list.size();
-            pem_list.push_back(po); // Null-terminate list
-            memcpy(pos, &pem_list[0], pem_list.size() * sizeof(*pos));
+            esp_sslclient_free(&pos);
+            return nullptr;
         }
+
+        *num = b.count;
         return pos;
     }
 
     // Parse out DER or PEM encoded certificates from a binary buffer,
-    // potentially stored in PROGMEM.
-    static br_x509_certificate *read_certificates(const char *buff, size_t len, size_t *num)
+    // potentially stored in PROGMEM. The certificate data is held by one
+    // block returned in *arena, to be freed once the certificates are unused.
+    static br_x509_certificate *read_certificates(const char *buff, size_t len, size_t *num, void **arena)
     {
-        Vector<br_x509_certificate> cert_list;
         pem_object *pos = nullptr;
-        size_t u = 0, num_pos = 0;
+        size_t u = 0, num_pos = 0, count = 0;
         br_x509_certificate *xcs = nullptr;
-        br_x509_certificate dummy;
 
         *num = 0;
+        *arena = nullptr;
 
         if (looks_like_DER(reinterpret_cast<const unsigned char *>(buff), len))
         {
@@ -392,6 +571,7 @@ namespace key_bssl
             xcs[1].data = nullptr;
             xcs[1].data_len = 0;
             *num = 1;
+            *arena = xcs[0].data;
             return xcs;
         }
 
@@ -402,57 +582,65 @@ namespace key_bssl
         for (u = 0; u < num_pos; u++)
         {
             if (!strcmp_P(pos[u].name, PSTR("CERTIFICATE")) || !strcmp_P(pos[u].name, PSTR("X509 CERTIFICATE")))
-            {
-                br_x509_certificate xc;
-                xc.data = pos[u].data;
-                xc.data_len = pos[u].data_len;
-                pos[u].data = nullptr; // Don't free the data we moved to the xc vector!
-                cert_list.push_back(xc);
-            }
-        }
-        for (u = 0; u < num_pos; u++)
-        {
-            free_pem_object_contents(&pos[u]);
+                count++;
         }
-        esp_sslclient_free(&pos);
 
-        if (cert_list.size() == 0)
+        if (count > 0)
+            xcs = reinterpret_cast<br_x509_certificate *>(esp_sslclient_malloc((count + 1) * sizeof(*xcs)));
+        if (!xcs)
+        {
+            free_pem_object(pos);
             return nullptr;
+        }
 
-        *num = cert_list.size();
-        dummy.data = nullptr;
-        dummy.data_len = 0;
-        cert_list.push_back(dummy);
-        xcs = reinterpret_cast<br_x509_certificate *>(esp_sslclient_malloc(cert_list.size() * sizeof(*xcs)));
-        if (!xcs)
+        // The other objects (e.g. a PRIVATE KEY next to the certificate) are
+        // zeroed and not kept
+        count = 0;
+        for (u = 0; u < num_pos; u++)
         {
-            for (size_t i = 0; i < cert_list.size(); i++)
+            if (!strcmp_P(pos[u].name, PSTR("CERTIFICATE")) || !strcmp_P(pos[u].name, PSTR("X509 CERTIFICATE")))
             {
-                free(cert_list[i].data); // Clean up any captured data blobs
+                xcs[count].data = pos[u].data;
+                xcs[count].data_len = pos[u].data_len;
+                count++;
             }
-            return nullptr;
+            else
+                memset(pos[u].data, 0, pos[u].data_len);
         }
-        memcpy(xcs, &cert_list[0], cert_list.size() * sizeof(br_x509_certificate));
-        // XCS now has [].data pointing to the previously allocated blobs, so don't
-        // want to free anything in cert_list[].
-        return xcs;
-    }
-
-    static void free_certificates(br_x509_certificate *certs, size_t num)
-    {
-        if (certs)
+        xcs[count].data = nullptr;
+        xcs[count].data_len = 0;
+
+        // Move the certificate data (in source order, so always backwards) to
+        // the start of the block, which the certificates then own, and shrink
+        // it to that.
+        unsigned char *block = reinterpret_cast<unsigned char *>(pos);
+        size_t used = 0;
+        for (u = 0; u < count; u++)
+        {
+            memmove(block + used, xcs[u].data, xcs[u].data_len);
+            xcs[u].data = block + used;
+            used += xcs[u].data_len;
+        }
+        unsigned char *shrunk = used > 0 ? reinterpret_cast<unsigned char *>(esp_sslclient_realloc(block, used)) : nullptr;
+        if (shrunk)
         {
-            for (size_t u = 0; u < num; u++)
+            block = shrunk;
+            used = 0;
+            for (u = 0; u < count; u++)
             {
-                free(certs[u].data);
+                xcs[u].data = block + used;
+                used += xcs[u].data_len;
             }
-            esp_sslclient_free(&certs);
         }
+
+        *num = count;
+        *arena = block;
+        return xcs;
     }
 
     static public_key *decode_public_key(const unsigned char *buff, size_t len)
     {
-        ReadyUtils::unique_ptr<br_pkey_decoder_context> dc(new br_pkey_decoder_context); // auto-delete on exit
+        scratch_ptr<br_pkey_decoder_context> dc(scratch_new<br_pkey_decoder_context>()); // auto-free on exit
         if (!dc.get())
             return nullptr;
 
@@ -529,7 +717,7 @@ namespace key_bssl
 
     static private_key *decode_private_key(const unsigned char *buff, size_t len)
     {
-        ReadyUtils::unique_ptr<br_skey_decoder_context> dc(new br_skey_decoder_context); // auto-delete on exit
+        scratch_ptr<br_skey_decoder_context> dc(scratch_new<br_skey_decoder_context>()); // auto-free on exit
         if (!dc.get())
             return nullptr;
 
@@ -622,14 +810,8 @@ namespace key_bssl
 
     static void free_pem_object(pem_object *pos)
     {
-        if (pos != nullptr)
-        {
-            for (size_t u = 0; pos[u].name; u++)
-            {
-                free_pem_object_contents(&pos[u]);
-            }
-            esp_sslclient_free(&pos);
-        }
+        // The objects, their data and names are one block
+        esp_sslclient_free(&pos);
     }
 
     static private_key *read_private_key(const char *buff, size_t len)
@@ -711,6 +893,19 @@ namespace key_bssl
 #endif
 
 #if defined(BSSL_BUILD_INTERNAL_CORE) || defined(BSSL_BUILD_PLATFORM_CORE)
+
+// Largest session ticket (RFC 5077) kept. Session tickets are off by default
+// as every BearSSL_Session and BearSSL_SessionCache entry holds a ticket
+// buffer of this size; define it (e.g. 512) to enable them.
+#if !defined(BSSL_SESSION_TICKET_MAX_LEN)
+#define BSSL_SESSION_TICKET_MAX_LEN 0
+#endif
+
+// Session tickets need the ticket support of the bundled BearSSL.
+#if defined(BR_SSL_CLIENT_SESSION_TICKETS) && BSSL_SESSION_TICKET_MAX_LEN > 0
+#define BSSL_SESSION_TICKETS
+#endif
+
 // Cache for a TLS session with a server
 // Use with BearSSL::WiFiClientSecure::setSession
 // to accelerate the TLS handshake
@@ -723,11 +918,323 @@ public:
 
     br_ssl_session_parameters *getSession() { return &_session; }
 
+#if defined(BSSL_SESSION_TICKETS)
+    // The session ticket issued by the server, if any.
+    const uint8_t *getTicket() const { return _ticket; }
+
+    size_t getTicketLength() const { return _ticket_len; }
+
+    // Ticket lifetime hint from the server in seconds, 0 if unspecified.
+    uint32_t getTicketLifetime() const { return _ticket_lifetime; }
+#endif
+
 private:
     // The actual BearSSL session information
     br_ssl_session_parameters _session;
+#if defined(BSSL_SESSION_TICKETS)
+    // Resumes the session on servers that keep no session cache
+    uint8_t _ticket[BSSL_SESSION_TICKET_MAX_LEN];
+    size_t _ticket_len = 0;
+    uint32_t _ticket_lifetime = 0;
+#endif
+};
+
+// Client side cache of TLS sessions for many servers, keyed by server name
+// and port, with least recently used eviction.
+// Use with BSSL_SSLClient::setSessionCache; the client looks up the session
+// before the handshake and stores it after the handshake and on stop().
+// Session tickets are kept with the session, so entries take
+// BSSL_SESSION_TICKET_MAX_LEN more bytes each when tickets are enabled.
+// The cache can be saved to a byte buffer (e.g. RTC memory or a file) to
+// resume sessions after deep sleep or a reboot. The saved data includes the
+// session master secrets and should be stored accordingly.
+class BearSSL_SessionCache
+{
+public:
+    explicit BearSSL_SessionCache(size_t capacity = 4)
+    {
+        // the serialized entry count is one byte
+        if (capacity > 255)
+            capacity = 255;
+        _entries = reinterpret_cast<entry_t *>(esp_sslclient_malloc(capacity * sizeof(entry_t)));
+        _capacity = _entries ? capacity : 0;
+        clear();
+    }
+
+    ~BearSSL_SessionCache() { esp_sslclient_free(&_entries); }
+
+    // Copies the session for host:port into params, false if there is none.
+    // The session ticket is copied to ticket (BSSL_SESSION_TICKET_MAX_LEN
+    // bytes) when given, and its length to ticket_len.
+    bool lookup(const char *host, uint16_t port, br_ssl_session_parameters *params, uint8_t *ticket = nullptr, size_t *ticket_len = nullptr)
+    {
+        entry_t *e = mFind(host, port);
+        if (!e)
+            return false;
+        e->tick = ++_tick;
+        memcpy(params, &e->params, sizeof(br_ssl_session_parameters));
+        if (ticket_len)
+            *ticket_len = 0;
+#if defined(BSSL_SESSION_TICKETS)
+        if (ticket && ticket_len)
+        {
+            memcpy(ticket, e->ticket, e->ticket_len);
+            *ticket_len = e->ticket_len;
+        }
+#else
+        (void)ticket;
+#endif
+        return true;
+    }
+
+    // Stores the session for host:port, replacing the least recently used
+    // entry when the cache is full. Sessions with neither an ID nor a
+    // ticket are ignored.
+    void store(const char *host, uint16_t port, const br_ssl_session_parameters *params, const uint8_t *ticket = nullptr, size_t ticket_len = 0)
+    {
+#if defined(BSSL_SESSION_TICKETS)
+        if (!ticket || ticket_len > BSSL_SESSION_TICKET_MAX_LEN)
+            ticket_len = 0;
+#else
+        (void)ticket;
+        ticket_len = 0;
+#endif
+        if (!host || strlen(host) >= sizeof(_entries[0].host) || (params->session_id_len == 0 && ticket_len == 0) || _capacity == 0)
+            return;
+
+        entry_t *e = mFind(host, port);
+        if (!e)
+        {
+            e = &_entries[0];
+            for (size_t i = 1; i < _capacity; i++)
+            {
+                if (_entries[i].tick < e->tick)
+                    e = &_entries[i];
+            }
+            strcpy(e->host, host);
+            e->port = port;
+        }
+        e->tick = ++_tick;
+        memcpy(&e->params, params, sizeof(br_ssl_session_parameters));
+#if defined(BSSL_SESSION_TICKETS)
+        if (ticket_len > 0)
+            memcpy(e->ticket, ticket, ticket_len);
+        e->ticket_len = ticket_len;
+#endif
+    }
+
+    void remove(const char *host, uint16_t port)
+    {
+        entry_t *e = mFind(host, port);
+        if (e)
+            mReset(*e);
+    }
+
+    void clear()
+    {
+        for (size_t i = 0; i < _capacity; i++)
+            mReset(_entries[i]);
+        _tick = 0;
+    }
+
+    size_t capacity() const { return _capacity; }
+
+    size_t count() const
+    {
+        size_t n = 0;
+        for (size_t i = 0; i < _capacity; i++)
+        {
+            if (_entries[i].tick > 0)
+                n++;
+        }
+        return n;
+    }
+
+    // Bytes needed by serialize().
+    size_t serializedSize() const
+    {
+        size_t len = 5;
+        for (size_t i = 0; i < _capacity; i++)
+        {
+            if (_entries[i].tick > 0)
+                len += 1 + strlen(_entries[i].host) + record_len + mTicketLen(_entries[i]);
+        }
+        return len;
+    }
+
+    // Writes the cache to buf, oldest entry first so deserialize() restores
+    // the LRU order. Returns the number of bytes written, 0 if len is too small.
+    size_t serialize(uint8_t *buf, size_t len) const
+    {
+        if (!buf || len < serializedSize())
+            return 0;
+
+        uint8_t *p = buf;
+        memcpy(p, "BSC2", 4);
+        p += 4;
+        *p++ = static_cast<uint8_t>(count());
+
+        uint32_t last = 0;
+        for (;;)
+        {
+            // next entry by age
+            const entry_t *e = nullptr;
+            for (size_t i = 0; i < _capacity; i++)
+            {
+                if (_entries[i].tick > last && (!e || _entries[i].tick < e->tick))
+                    e = &_entries[i];
+            }
+            if (!e)
+                break;
+            last = e->tick;
+
+            const size_t host_len = strlen(e->host);
+            *p++ = static_cast<uint8_t>(host_len);
+            memcpy(p, e->host, host_len);
+            p += host_len;
+            mPut16(p, e->port);
+            mPut16(p + 2, e->params.version);
+            mPut16(p + 4, e->params.cipher_suite);
+            p[6] = e->params.session_id_len;
+            memcpy(p + 7, e->params.session_id, sizeof(e->params.session_id));
+            memcpy(p + 7 + sizeof(e->params.session_id), e->params.master_secret, sizeof(e->params.master_secret));
+            p += record_len;
+            const size_t ticket_len = mTicketLen(*e);
+            mPut16(p - 2, ticket_len);
+#if defined(BSSL_SESSION_TICKETS)
+            memcpy(p, e->ticket, ticket_len);
+#endif
+            p += ticket_len;
+        }
+        return p - buf;
+    }
+
+    // Replaces the cache content with the data written by serialize().
+    // Entries beyond the capacity (the oldest) are dropped, and so are the
+    // tickets when they are not supported. Data from the previous format
+    // (no tickets) is accepted.
+    bool deserialize(const uint8_t *buf, size_t len)
+    {
+        if (!buf || len < 5 || (memcmp(buf, "BSC1", 4) != 0 && memcmp(buf, "BSC2", 4) != 0))
+            return false;
+
+        const size_t rec_len = buf[3] == '1' ? record_len - 2 : record_len;
+
+        clear();
+        const uint8_t *p = buf + 5;
+        const uint8_t *end = buf + len;
+        for (uint8_t n = 0; n < buf[4]; n++)
+        {
+            if (p >= end || p + 1 + p[0] + rec_len > end || p[0] >= sizeof(_entries[0].host))
+            {
+                clear();
+                return false;
+            }
+
+            char host[sizeof(_entries[0].host)];
+            memcpy(host, p + 1, p[0]);
+            host[p[0]] = '\0';
+            p += 1 + p[0];
+
+            br_ssl_session_parameters params;
+            params.version = mGet16(p + 2);
+            params.cipher_suite = mGet16(p + 4);
+            params.session_id_len = p[6] <= sizeof(params.session_id) ? p[6] : 0;
+            memcpy(params.session_id, p + 7, sizeof(params.session_id));
+            memcpy(params.master_secret, p + 7 + sizeof(params.session_id), sizeof(params.master_secret));
+            const uint16_t port = mGet16(p);
+            p += rec_len;
+
+            const size_t ticket_len = rec_len == record_len ? mGet16(p - 2) : 0;
+            if (p + ticket_len > end)
+            {
+                clear();
+                return false;
+            }
+            store(host, port, &params, p, ticket_len);
+            p += ticket_len;
+        }
+        return true;
+    }
+
+    // Disable the copy constructor, we're pointer based
+    BearSSL_SessionCache(const BearSSL_SessionCache &that) = delete;
+    BearSSL_SessionCache &operator=(const BearSSL_SessionCache &that) = delete;
+
+private:
+    struct entry_t
+    {
+        char host[64];
+        uint16_t port;
+        // LRU stamp, 0 for an unused entry
+        uint32_t tick;
+        br_ssl_session_parameters params;
+#if defined(BSSL_SESSION_TICKETS)
+        uint8_t ticket[BSSL_SESSION_TICKET_MAX_LEN];
+        size_t ticket_len;
+#endif
+    };
+
+    // port, version, cipher suite, session id length, session id, master secret,
+    // ticket length (the ticket follows)
+    static const size_t record_len = 9 + sizeof(((br_ssl_session_parameters *)0)->session_id) + sizeof(((br_ssl_session_parameters *)0)->master_secret);
+
+    entry_t *mFind(const char *host, uint16_t port)
+    {
+        if (!host)
+            return nullptr;
+        for (size_t i = 0; i < _capacity; i++)
+        {
+            if (_entries[i].tick > 0 && _entries[i].port == port && strcmp(_entries[i].host, host) == 0)
+                return &_entries[i];
+        }
+        return nullptr;
+    }
+
+    static size_t mTicketLen(const entry_t &e)
+    {
+#if defined(BSSL_SESSION_TICKETS)
+        return e.ticket_len;
+#else
+        (void)e;
+        return 0;
+#endif
+    }
+
+    static void mReset(entry_t &e)
+    {
+        memset(&e, 0, sizeof(entry_t));
+    }
+
+    static void mPut16(uint8_t *p, uint16_t v)
+    {
+        p[0] = v & 0xff;
+        p[1] = v >> 8;
+    }
+
+    static uint16_t mGet16(const uint8_t *p) { return p[0] | (p[1] << 8); }
+
+    entry_t *_entries = nullptr;
+    size_t _capacity = 0;
+    uint32_t _tick = 0;
 };
 
+/* Compile-time cipher profile. Define one or more SSLCLIENT_SUITES_* macros
+ * to offer only those TLS 1.2 suites and install only the engines they use:
+ * ECDHE over the default EC implementation, ECDSA and/or RSA signature
+ * verification, ChaCha20-Poly1305 and/or AES-GCM records and SHA-256 for
+ * the handshake and PRF. RSA key exchange, CBC, CCM, 3DES, the TLS 1.0/1.1
+ * PRF and the other handshake hashes are not referenced, so the linker
+ * drops them. Certificate validation keeps all its hashes.
+ */
+#if defined(SSLCLIENT_SUITES_ECDHE_ECDSA_CHACHA20) || defined(SSLCLIENT_SUITES_ECDHE_RSA_CHACHA20) || \
+    defined(SSLCLIENT_SUITES_ECDHE_ECDSA_AES128_GCM) || defined(SSLCLIENT_SUITES_ECDHE_RSA_AES128_GCM)
+#define SSLCLIENT_CIPHER_PROFILE
+#if defined(BEARSSL_SSL_BASIC)
+#error "SSLCLIENT_SUITES_* need the EC support that BEARSSL_SSL_BASIC leaves out"
+#endif
+#endif
+
 /* The "full" profile supports all implemented cipher suites.
  *
  * Rationale for suite order, from most important to least
@@ -747,6 +1254,20 @@ private:
  *    strong enough, and AES-256 is 40% more expensive).
  */
 static const uint16_t suites_P[] PROGMEM = {
+#if defined(SSLCLIENT_CIPHER_PROFILE)
+#if defined(SSLCLIENT_SUITES_ECDHE_ECDSA_CHACHA20)
+    BR_TLS_ECDHE_ECDSA_WITH_CHACHA20_POLY1305_SHA256,
+#endif
+#if defined(SSLCLIENT_SUITES_ECDHE_RSA_CHACHA20)
+    BR_TLS_ECDHE_RSA_WITH_CHACHA20_POLY1305_SHA256,
+#endif
+#if defined(SSLCLIENT_SUITES_ECDHE_ECDSA_AES128_GCM)
+    BR_TLS_ECDHE_ECDSA_WITH_AES_128_GCM_SHA256,
+#endif
+#if defined(SSLCLIENT_SUITES_ECDHE_RSA_AES128_GCM)
+    BR_TLS_ECDHE_RSA_WITH_AES_128_GCM_SHA256,
+#endif
+#else
 #ifndef BEARSSL_SSL_BASIC
     BR_TLS_ECDHE_ECDSA_WITH_CHACHA20_POLY1305_SHA256,
     BR_TLS_ECDHE_RSA_WITH_CHACHA20_POLY1305_SHA256,
@@ -796,9 +1317,11 @@ static const uint16_t suites_P[] PROGMEM = {
     BR_TLS_ECDH_RSA_WITH_3DES_EDE_CBC_SHA,
     BR_TLS_RSA_WITH_3DES_EDE_CBC_SHA
 #endif
+#endif // SSLCLIENT_CIPHER_PROFILE
 };
 
 // For apps which want to use less secure but faster ciphers, only
+// (none of them is in a cipher profile)
 static const uint16_t faster_suites_P[] PROGMEM = {
     BR_TLS_RSA_WITH_AES_256_CBC_SHA256,
     BR_TLS_RSA_WITH_AES_128_CBC_SHA256,
@@ -897,6 +1420,16 @@ namespace bssl
             return &_key->key.ec;
         }
 
+        // Heap bytes held for the key
+        size_t getMemoryUsage() const
+        {
+            if (!_key)
+                return 0;
+            if (_key->key_type == BR_KEYTYPE_RSA)
+                return sizeof(*_key) + _key->key.rsa.nlen + _key->key.rsa.elen;
+            return sizeof(*_key) + _key->key.ec.qlen;
+        }
+
         // Disable the copy constructor, we're pointer based
         PublicKey(const PublicKey &that) = delete;
         PublicKey &operator=(const PublicKey &that) = delete;
@@ -986,6 +1519,16 @@ namespace bssl
             return &_key->key.ec;
         }
 
+        // Heap bytes held for the key
+        size_t getMemoryUsage() const
+        {
+            if (!_key)
+                return 0;
+            if (_key->key_type == BR_KEYTYPE_RSA)
+                return sizeof(*_key) + _key->key.rsa.plen + _key->key.rsa.qlen + _key->key.rsa.dplen + _key->key.rsa.dqlen + _key->key.rsa.iqlen;
+            return sizeof(*_key) + _key->key.ec.xlen;
+        }
+
         // Disable the copy constructor, we're pointer based
         PrivateKey(const PrivateKey &that) = delete;
         PrivateKey &operator=(const PrivateKey &that) = delete;
@@ -1011,12 +1554,16 @@ namespace bssl
             _count = 0;
             _cert = nullptr;
             _ta = nullptr;
+            _arenas = nullptr;
+            _arena_count = 0;
         }
         explicit X509List(const char *pemCert)
         {
             _count = 0;
             _cert = nullptr;
             _ta = nullptr;
+            _arenas = nullptr;
+            _arena_count = 0;
             append(pemCert);
         }
         explicit X509List(const uint8_t *derCert, size_t derLen)
@@ -1024,6 +1571,8 @@ namespace bssl
             _count = 0;
             _cert = nullptr;
             _ta = nullptr;
+            _arenas = nullptr;
+            _arena_count = 0;
             append(derCert, derLen);
         }
         explicit X509List(Stream &stream, size_t size)
@@ -1031,6 +1580,8 @@ namespace bssl
             _count = 0;
             _cert = nullptr;
             _ta = nullptr;
+            _arenas = nullptr;
+            _arena_count = 0;
             auto buff = key_bssl::loadStream(stream, size);
             if (buff)
             {
@@ -1041,7 +1592,13 @@ namespace bssl
         explicit X509List(Stream &stream) : X509List(stream, stream.available()) {};
         ~X509List()
         {
-            key_bssl::free_certificates(_cert, _count); // also frees cert
+            // The certificate data lives in one block per append()
+            for (size_t i = 0; i < _arena_count; i++)
+            {
+                esp_sslclient_free(&_arenas[i]);
+            }
+            esp_sslclient_free(&_arenas);
+            esp_sslclient_free(&_cert);
             for (size_t i = 0; i < _count; i++)
             {
                 key_bssl::free_ta_contents(&_ta[i]);
@@ -1053,10 +1610,23 @@ namespace bssl
         bool append(const uint8_t *derCert, size_t derLen)
         {
             size_t numCerts;
-            br_x509_certificate *newCerts = key_bssl::read_certificates(reinterpret_cast<const char *>(derCert), derLen, &numCerts);
+            void *arena = nullptr;
+            br_x509_certificate *newCerts = key_bssl::read_certificates(reinterpret_cast<const char *>(derCert), derLen, &numCerts, &arena);
             if (!newCerts)
                 return false;
 
+            // Keep the block holding the certificate data
+            void **saveArenas = _arenas;
+            _arenas = reinterpret_cast<void **>(esp_sslclient_realloc(_arenas, (_arena_count + 1) * sizeof(void *)));
+            if (!_arenas)
+            {
+                esp_sslclient_free(&newCerts);
+                esp_sslclient_free(&arena);
+                _arenas = saveArenas;
+                return false;
+            }
+            _arenas[_arena_count++] = arena;
+
             // Add in the certificates
             br_x509_certificate *saveCert = _cert;
             _cert = reinterpret_cast<br_x509_certificate *>(esp_sslclient_realloc(_cert, (numCerts + _count) * sizeof(br_x509_certificate)));
@@ -1100,6 +1670,22 @@ namespace bssl
 
         const br_x509_trust_anchor *getTrustAnchors() const { return _ta; }
 
+        // Heap bytes held for the certificates and trust anchors (the PEM
+        // object names and the allocator overhead are not counted)
+        size_t getMemoryUsage() const
+        {
+            size_t bytes = _arena_count * sizeof(void *) + _count * (sizeof(br_x509_certificate) + sizeof(br_x509_trust_anchor));
+            for (size_t i = 0; i < _count; i++)
+            {
+                bytes += _cert[i].data_len + _ta[i].dn.len;
+                if (_ta[i].pkey.key_type == BR_KEYTYPE_RSA)
+                    bytes += _ta[i].pkey.key.rsa.nlen + _ta[i].pkey.key.rsa.elen;
+                else
+                    bytes += _ta[i].pkey.key.ec.qlen;
+            }
+            return bytes;
+        }
+
         // Disable the copy constructor, we're pointer based
         explicit X509List(const X509List &that) = delete;
         X509List &operator=(const X509List &that) = delete;
@@ -1108,6 +1694,8 @@ namespace bssl
         size_t _count;
         br_x509_certificate *_cert;
         br_x509_trust_anchor *_ta;
+        void **_arenas;
+        size_t _arena_count;
     };
 
 #endif
@@ -1137,15 +1725,149 @@ namespace bssl
             br_x509_minimal_set_hash(x509, br_sha512_ID, &br_sha512_vtable);
         }
 
-        // Default initializion for our SSL clients
+// Record engines of the build: all of them, or those of the cipher profile
+#if !defined(SSLCLIENT_CIPHER_PROFILE)
+#define BSSL_RECORD_CBC
+#if !defined(BEARSSL_SSL_BASIC)
+#define BSSL_RECORD_GCM
+#define BSSL_RECORD_CCM
+#define BSSL_RECORD_CHAPOL
+#endif
+#else
+#if defined(SSLCLIENT_SUITES_ECDHE_ECDSA_AES128_GCM) || defined(SSLCLIENT_SUITES_ECDHE_RSA_AES128_GCM)
+#define BSSL_RECORD_GCM
+#endif
+#if defined(SSLCLIENT_SUITES_ECDHE_ECDSA_CHACHA20) || defined(SSLCLIENT_SUITES_ECDHE_RSA_CHACHA20)
+#define BSSL_RECORD_CHAPOL
+#endif
+#endif
+
+        // Cipher backends for the record engines, picked once per process.
+        // BearSSL's defaults pick the fastest the CPU runs (AES-NI, PCLMUL and
+        // SSE2/AVX2 on x86, POWER8 crypto, else the constant-time portable code),
+        // but probe CPUID on every call, i.e. on every connect().
+        struct br_ssl_record_backends
+        {
+            const br_block_cbcenc_class *aes_cbcenc;
+            const br_block_cbcdec_class *aes_cbcdec;
+            const br_block_ctr_class *aes_ctr;
+            const br_block_ctrcbc_class *aes_ctrcbc;
+            br_ghash ghash;
+            br_chacha20_run chacha20;
+            br_poly1305_run poly1305;
+        };
+
+        // Runs the BearSSL defaults on eng and keeps what they installed.
+        static br_ssl_record_backends br_ssl_record_backends_probe(br_ssl_engine_context *eng)
+        {
+            br_ssl_record_backends b;
+            memset(&b, 0, sizeof(b));
+#if defined(BSSL_RECORD_CBC)
+            br_ssl_engine_set_default_aes_cbc(eng);
+            b.aes_cbcenc = eng->iaes_cbcenc;
+            b.aes_cbcdec = eng->iaes_cbcdec;
+#endif
+#if defined(BSSL_RECORD_GCM)
+            br_ssl_engine_set_default_aes_gcm(eng);
+            b.aes_ctr = eng->iaes_ctr;
+            b.ghash = eng->ighash;
+#endif
+#if defined(BSSL_RECORD_CCM)
+            br_ssl_engine_set_default_aes_ccm(eng);
+            b.aes_ctrcbc = eng->iaes_ctrcbc;
+#endif
+#if defined(BSSL_RECORD_CHAPOL)
+            br_ssl_engine_set_default_chapol(eng);
+            b.chacha20 = eng->ichacha;
+            b.poly1305 = eng->ipoly;
+#endif
+            return b;
+        }
+
+        // The backends the record engines of this build use on this CPU,
+        // probed on the first call with eng as scratch.
+        static const br_ssl_record_backends *br_ssl_record_backends_get(br_ssl_engine_context *eng)
+        {
+            static const br_ssl_record_backends backends = br_ssl_record_backends_probe(eng);
+            return &backends;
+        }
+
+        // Same as the BearSSL record engine defaults, without the probing.
+        static void br_ssl_engine_set_record_backends(br_ssl_engine_context *eng)
+        {
+            const br_ssl_record_backends *b = br_ssl_record_backends_get(eng);
+#if defined(BSSL_RECORD_CBC)
+            br_ssl_engine_set_cbc(eng, &br_sslrec_in_cbc_vtable, &br_sslrec_out_cbc_vtable);
+            br_ssl_engine_set_aes_cbc(eng, b->aes_cbcenc, b->aes_cbcdec);
+#endif
+#if defined(BSSL_RECORD_GCM)
+            br_ssl_engine_set_gcm(eng, &br_sslrec_in_gcm_vtable, &br_sslrec_out_gcm_vtable);
+            br_ssl_engine_set_aes_ctr(eng, b->aes_ctr);
+            br_ssl_engine_set_ghash(eng, b->ghash);
+#endif
+#if defined(BSSL_RECORD_CCM)
+            br_ssl_engine_set_ccm(eng, &br_sslrec_in_ccm_vtable, &br_sslrec_out_ccm_vtable);
+            br_ssl_engine_set_aes_ctrcbc(eng, b->aes_ctrcbc);
+#endif
+#if defined(BSSL_RECORD_CHAPOL)
+            br_ssl_engine_set_chapol(eng, &br_sslrec_in_chapol_vtable, &br_sslrec_out_chapol_vtable);
+            br_ssl_engine_set_chacha20(eng, b->chacha20);
+            br_ssl_engine_set_poly1305(eng, b->poly1305);
+#endif
+        }
+
+#if defined(SSLCLIENT_CIPHER_PROFILE)
+        static bool br_ssl_profile_has_suite(uint16_t suite)
+        {
+            for (size_t i = 0; i < sizeof(suites_P) / sizeof(suites_P[0]); i++)
+            {
+                if (pgm_read_word(&suites_P[i]) == suite)
+                    return true;
+            }
+            return false;
+        }
+
+        // Only the engines of the profile suites. The chain validator takes
+        // its signature verifiers from the engine and a chain can mix RSA and
+        // ECDSA, so both are kept unless no chain is validated.
+        static void br_ssl_client_profile_init(br_ssl_client_context *cc)
+        {
+#if defined(SSLCLIENT_SUITES_ECDHE_ECDSA_CHACHA20) || defined(SSLCLIENT_SUITES_ECDHE_ECDSA_AES128_GCM) || !defined(SSLCLIENT_INSECURE_ONLY)
+            br_ssl_engine_set_default_ecdsa(&cc->eng);
+#else
+            br_ssl_engine_set_ec(&cc->eng, br_ec_get_default());
+#endif
+#if defined(SSLCLIENT_SUITES_ECDHE_RSA_CHACHA20) || defined(SSLCLIENT_SUITES_ECDHE_RSA_AES128_GCM) || !defined(SSLCLIENT_INSECURE_ONLY)
+            br_ssl_engine_set_default_rsavrfy(&cc->eng);
+#endif
+            br_ssl_engine_set_hash(&cc->eng, br_sha256_ID, &br_sha256_vtable);
+            br_ssl_engine_set_prf_sha256(&cc->eng, &br_tls12_sha256_prf);
+            br_ssl_engine_set_record_backends(&cc->eng);
+        }
+#endif
+
+        // Default initializion for our SSL clients. With a cipher profile, the
+        // suites of cipher_list outside of it are dropped.
         static void br_ssl_client_base_init(br_ssl_client_context *cc, const uint16_t *cipher_list, int cipher_cnt)
         {
-            uint16_t suites[cipher_cnt];
-            memcpy_P(suites, cipher_list, cipher_cnt * sizeof(cipher_list[0]));
+            uint16_t suites[BR_MAX_CIPHER_SUITES];
+            size_t count = 0;
+            for (int i = 0; i < cipher_cnt && count < BR_MAX_CIPHER_SUITES; i++)
+            {
+                const uint16_t suite = pgm_read_word(&cipher_list[i]);
+#if defined(SSLCLIENT_CIPHER_PROFILE)
+                if (!br_ssl_profile_has_suite(suite))
+                    continue;
+#endif
+                suites[count++] = suite;
+            }
             br_ssl_client_zero(cc);
             br_ssl_engine_add_flags(&cc->eng, BR_OPT_NO_RENEGOTIATION); // forbid SSL renegotiation, as we free the Private Key after handshake
             br_ssl_engine_set_versions(&cc->eng, BR_TLS10, BR_TLS12);
-            br_ssl_engine_set_suites(&cc->eng, suites, (sizeof suites) / (sizeof suites[0]));
+            br_ssl_engine_set_suites(&cc->eng, suites, count);
+#if defined(SSLCLIENT_CIPHER_PROFILE)
+            br_ssl_client_profile_init(cc);
+#else
             br_ssl_client_set_default_rsapub(cc);
             br_ssl_engine_set_default_rsavrfy(&cc->eng);
 #ifndef BEARSSL_SSL_BASIC
@@ -1155,45 +1877,82 @@ namespace bssl
             br_ssl_engine_set_prf10(&cc->eng, &br_tls10_prf);
             br_ssl_engine_set_prf_sha256(&cc->eng, &br_tls12_sha256_prf);
             br_ssl_engine_set_prf_sha384(&cc->eng, &br_tls12_sha384_prf);
-            br_ssl_engine_set_default_aes_cbc(&cc->eng);
+            br_ssl_engine_set_record_backends(&cc->eng);
 #ifndef BEARSSL_SSL_BASIC
-            br_ssl_engine_set_default_aes_gcm(&cc->eng);
-            br_ssl_engine_set_default_aes_ccm(&cc->eng);
             br_ssl_engine_set_default_des_cbc(&cc->eng);
-            br_ssl_engine_set_default_chapol(&cc->eng);
 #endif
+#endif // SSLCLIENT_CIPHER_PROFILE
         }
 
         // BearSSL doesn't define a true insecure decoder, so we make one ourselves
-        // from the simple parser.  It generates the issuer and subject hashes and
-        // the SHA1 fingerprint, only one (or none!) of which will be used to
-        // "verify" the certificate.
+        // from the simple parser.  It generates the SHA1 fingerprint and the
+        // issuer and subject hashes, but only those the policy uses: none for
+        // setInsecure(), the fingerprint for match_fingerprint and the DN hashes
+        // for allow_self_signed.
 
-        // Private x509 decoder state
+        // Private x509 decoder state. The hashes in use follow it in the same
+        // block, laid out by insecure_context_layout().
         struct br_x509_insecure_context
         {
             const br_x509_class *vtable;
             bool done_cert;
             const uint8_t *match_fingerprint;
-            br_sha1_context sha1_cert;
             bool allow_self_signed;
+            br_sha1_context *sha1_cert;
+            br_sha256_context *sha256_subject;
+            br_sha256_context *sha256_issuer;
+            br_x509_decoder_context ctx;
+        };
+
+        // Room for the context with every hash, for static storage.
+        struct br_x509_insecure_storage
+        {
+            br_x509_insecure_context xc;
+            br_sha1_context sha1_cert;
             br_sha256_context sha256_subject;
             br_sha256_context sha256_issuer;
-            br_x509_decoder_context ctx;
         };
 
+        static size_t insecure_align(size_t offset, size_t align) { return (offset + align - 1) & ~(align - 1); }
+
+        // Returns the bytes of a context with the hashes of the policy and, if
+        // xc is set, points its hashes into the block.
+        static size_t insecure_context_layout(br_x509_insecure_context *xc, bool match_fingerprint, bool allow_self_signed)
+        {
+            uint8_t *base = reinterpret_cast<uint8_t *>(xc);
+            size_t len = sizeof(br_x509_insecure_context);
+            if (match_fingerprint)
+            {
+                len = insecure_align(len, alignof(br_sha1_context));
+                if (xc)
+                    xc->sha1_cert = reinterpret_cast<br_sha1_context *>(base + len);
+                len += sizeof(br_sha1_context);
+            }
+            if (allow_self_signed)
+            {
+                len = insecure_align(len, alignof(br_sha256_context));
+                if (xc)
+                {
+                    xc->sha256_subject = reinterpret_cast<br_sha256_context *>(base + len);
+                    xc->sha256_issuer = xc->sha256_subject + 1;
+                }
+                len += 2 * sizeof(br_sha256_context);
+            }
+            return len;
+        }
+
         // Callback for the x509_minimal subject DN
         static void insecure_subject_dn_append(void *ctx, const void *buf, size_t len)
         {
             br_x509_insecure_context *xc = reinterpret_cast<br_x509_insecure_context *>(ctx);
-            br_sha256_update(&xc->sha256_subject, buf, len);
+            br_sha256_update(xc->sha256_subject, buf, len);
         }
 
         // Callback for the x509_minimal issuer DN
         static void insecure_issuer_dn_append(void *ctx, const void *buf, size_t len)
         {
             br_x509_insecure_context *xc = reinterpret_cast<br_x509_insecure_context *>(ctx);
-            br_sha256_update(&xc->sha256_issuer, buf, len);
+            br_sha256_update(xc->sha256_issuer, buf, len);
         }
 
         // Callback for each certificate present in the chain (but only operates
@@ -1211,7 +1970,8 @@ namespace bssl
             // Don't process anything but the first certificate in the chain
             if (!xc->done_cert)
             {
-                br_sha1_update(&xc->sha1_cert, buf, len);
+                if (xc->sha1_cert)
+                    br_sha1_update(xc->sha1_cert, buf, len);
                 br_x509_decoder_push(&xc->ctx, reinterpret_cast<const void *>(buf), len);
             }
         }
@@ -1219,15 +1979,21 @@ namespace bssl
         static void insecure_start_chain(const br_x509_class **ctx, const char *server_name)
         {
             br_x509_insecure_context *xc = reinterpret_cast<br_x509_insecure_context *>(ctx);
+            // The DNs are only decoded for the self-signed check
+            const bool dn = xc->sha256_subject != nullptr;
 #if defined(BSSL_BUILD_PLATFORM_CORE)
-            br_x509_decoder_init(&xc->ctx, insecure_subject_dn_append, xc, insecure_issuer_dn_append, xc);
+            br_x509_decoder_init(&xc->ctx, dn ? insecure_subject_dn_append : nullptr, xc, dn ? insecure_issuer_dn_append : nullptr, xc);
 #elif defined(ESP32) || defined(BSSL_BUILD_INTERNAL_CORE)
-            br_x509_decoder_init(&xc->ctx, insecure_subject_dn_append, xc);
+            br_x509_decoder_init(&xc->ctx, dn ? insecure_subject_dn_append : nullptr, xc);
 #endif
             xc->done_cert = false;
-            br_sha1_init(&xc->sha1_cert);
-            br_sha256_init(&xc->sha256_subject);
-            br_sha256_init(&xc->sha256_issuer);
+            if (xc->sha1_cert)
+                br_sha1_init(xc->sha1_cert);
+            if (dn)
+            {
+                br_sha256_init(xc->sha256_subject);
+                br_sha256_init(xc->sha256_issuer);
+            }
             (void)server_name;
         }
 
@@ -1250,20 +2016,26 @@ namespace bssl
             }
 
             // Handle SHA1 fingerprint matching
-            char res[20];
-            br_sha1_out(&xc->sha1_cert, res);
-            if (xc->match_fingerprint && memcmp(res, xc->match_fingerprint, sizeof(res)))
-                return BR_ERR_X509_NOT_TRUSTED;
+            if (xc->match_fingerprint)
+            {
+                char res[20];
+                br_sha1_out(xc->sha1_cert, res);
+                if (memcmp(res, xc->match_fingerprint, sizeof(res)))
+                    return BR_ERR_X509_NOT_TRUSTED;
+            }
 
             // Handle self-signer certificate acceptance
-            char res_issuer[32];
-            char res_subject[32];
-            br_sha256_out(&xc->sha256_issuer, res_issuer);
-            br_sha256_out(&xc->sha256_subject, res_subject);
-            if (xc->allow_self_signed && memcmp(res_subject, res_issuer, sizeof(res_issuer)))
+            if (xc->allow_self_signed)
             {
-                // BSSL_BSSL_SSL_Client_DEBUG_PRINTF("insecure_end_chain: Didn't get self-signed cert\n");
-                return BR_ERR_X509_NOT_TRUSTED;
+                char res_issuer[32];
+                char res_subject[32];
+                br_sha256_out(xc->sha256_issuer, res_issuer);
+                br_sha256_out(xc->sha256_subject, res_subject);
+                if (memcmp(res_subject, res_issuer, sizeof(res_issuer)))
+                {
+                    // BSSL_BSSL_SSL_Client_DEBUG_PRINTF("insecure_end_chain: Didn't get self-signed cert\n");
+                    return BR_ERR_X509_NOT_TRUSTED;
+                }
             }
 
             // Default (no validation at all) or no errors in prior checks = success.
@@ -1278,6 +2050,193 @@ namespace bssl
                 *usages = BR_KEYTYPE_KEYX | BR_KEYTYPE_SIGN; // I said we were insecure!
             return &xc->ctx.pkey;
         }
+
+        // Pinning validator: accepts the chain if the SHA-256 of the leaf's
+        // SubjectPublicKeyInfo (or of the whole leaf for certificate pins) is
+        // one of the pins. The leaf is decoded and hashed in the same pass,
+        // the rest of the chain is ignored, and no trust anchor, date or
+        // server name is checked.
+
+        // Streaming DER walk of a certificate down to its SubjectPublicKeyInfo:
+        // Certificate SEQUENCE, tbsCertificate SEQUENCE, then the optional [0]
+        // version and serial, signature, issuer, validity and subject.
+        struct br_x509_spki_scanner
+        {
+            uint8_t state;
+            uint8_t depth;    // 0 certificate, 1 tbsCertificate, 2 its elements
+            uint8_t index;    // tbsCertificate element, version excluded
+            uint8_t hdr[6];   // tag and length of the element being read
+            uint8_t hdr_len;
+            uint8_t len_left; // long form length bytes still to read
+            uint32_t left;    // content bytes still to skip or hash
+        };
+
+        enum spki_scan_state
+        {
+            spki_scan_header,
+            spki_scan_skip,
+            spki_scan_hash,
+            spki_scan_done,
+            spki_scan_error
+        };
+
+        static void spki_scan_init(br_x509_spki_scanner *sc) { memset(sc, 0, sizeof(*sc)); }
+
+        // Feeds certificate bytes; the SPKI element, header included, goes to sha.
+        static void spki_scan_push(br_x509_spki_scanner *sc, br_sha256_context *sha, const uint8_t *buf, size_t len)
+        {
+            while (len > 0 && sc->state < spki_scan_done)
+            {
+                if (sc->state != spki_scan_header)
+                {
+                    size_t n = len < sc->left ? len : sc->left;
+                    if (sc->state == spki_scan_hash)
+                        br_sha256_update(sha, buf, n);
+                    buf += n;
+                    len -= n;
+                    sc->left -= n;
+                    if (sc->left == 0)
+                        sc->state = sc->state == spki_scan_hash ? spki_scan_done : spki_scan_header;
+                    continue;
+                }
+
+                const uint8_t b = *buf++;
+                len--;
+                sc->hdr[sc->hdr_len++] = b;
+                if (sc->hdr_len == 1)
+                {
+                    // Low tag numbers only, as in every X.509 structure
+                    if ((b & 0x1F) == 0x1F)
+                        sc->state = spki_scan_error;
+                    continue;
+                }
+                if (sc->hdr_len == 2)
+                {
+                    sc->left = b < 0x80 ? b : 0;
+                    sc->len_left = b < 0x80 ? 0 : b & 0x7F;
+                    // DER has no indefinite length, and 4 length bytes is plenty
+                    if (b == 0x80 || sc->len_left > 4)
+                        sc->state = spki_scan_error;
+                }
+                else
+                {
+                    sc->left = (sc->left << 8) | b;
+                    sc->len_left--;
+                }
+                if (sc->state == spki_scan_error || sc->len_left > 0)
+                    continue;
+
+                // Header complete
+                const uint8_t tag = sc->hdr[0];
+                sc->hdr_len = 0;
+                if (sc->depth < 2)
+                {
+                    if (tag != 0x30)
+                        sc->state = spki_scan_error;
+                    sc->depth++;
+                    continue;
+                }
+                if (sc->index == 0 && tag == 0xA0)
+                    sc->state = spki_scan_skip; // version
+                else if (sc->index++ < 5)
+                    sc->state = spki_scan_skip; // serial, signature, issuer, validity, subject
+                else if (tag != 0x30 || sc->left == 0)
+                    sc->state = spki_scan_error;
+                else
+                {
+                    br_sha256_update(sha, sc->hdr, 2 + (sc->hdr[1] & 0x80 ? sc->hdr[1] & 0x7F : 0));
+                    sc->state = spki_scan_hash;
+                }
+                if (sc->state == spki_scan_skip && sc->left == 0)
+                    sc->state = spki_scan_header;
+            }
+        }
+
+        // Computes the SPKI pin of a DER certificate, false if it has no SPKI.
+        static bool spki_sha256(const uint8_t *der, size_t len, uint8_t out[32])
+        {
+            br_x509_spki_scanner sc;
+            br_sha256_context sha;
+            spki_scan_init(&sc);
+            br_sha256_init(&sha);
+            spki_scan_push(&sc, &sha, der, len);
+            if (sc.state != spki_scan_done)
+                return false;
+            br_sha256_out(&sha, out);
+            return true;
+        }
+
+        // Private x509 decoder state
+        struct br_x509_pin_context
+        {
+            const br_x509_class *vtable;
+            bool done_cert;
+            const uint8_t (*pins)[32];
+            size_t pin_count;
+            bool match_cert; // pins are of the whole certificate, not its SPKI
+            br_x509_spki_scanner scan;
+            br_sha256_context sha256;
+            br_x509_decoder_context ctx;
+        };
+
+        static void pin_start_chain(const br_x509_class **ctx, const char *server_name)
+        {
+            br_x509_pin_context *xc = reinterpret_cast<br_x509_pin_context *>(ctx);
+#if defined(BSSL_BUILD_PLATFORM_CORE)
+            br_x509_decoder_init(&xc->ctx, nullptr, nullptr, nullptr, nullptr);
+#elif defined(ESP32) || defined(BSSL_BUILD_INTERNAL_CORE)
+            br_x509_decoder_init(&xc->ctx, nullptr, nullptr);
+#endif
+            xc->done_cert = false;
+            spki_scan_init(&xc->scan);
+            br_sha256_init(&xc->sha256);
+            (void)server_name;
+        }
+
+        // Only the first certificate is decoded and hashed.
+        static void pin_append(const br_x509_class **ctx, const unsigned char *buf, size_t len)
+        {
+            br_x509_pin_context *xc = reinterpret_cast<br_x509_pin_context *>(ctx);
+            if (xc->done_cert)
+                return;
+            if (xc->match_cert)
+                br_sha256_update(&xc->sha256, buf, len);
+            else
+                spki_scan_push(&xc->scan, &xc->sha256, buf, len);
+            br_x509_decoder_push(&xc->ctx, buf, len);
+        }
+
+        static void pin_end_cert(const br_x509_class **ctx) { reinterpret_cast<br_x509_pin_context *>(ctx)->done_cert = true; }
+
+        static unsigned pin_end_chain(const br_x509_class **ctx)
+        {
+            const br_x509_pin_context *xc = reinterpret_cast<const br_x509_pin_context *>(ctx);
+            if (!xc->done_cert)
+                return BR_ERR_X509_EMPTY_CHAIN;
+            // The key handed to the engine must come from a fully decoded leaf
+            const int err = br_x509_decoder_last_error(const_cast<br_x509_decoder_context *>(&xc->ctx));
+            if (err != 0)
+                return err;
+            if (!xc->match_cert && xc->scan.state != spki_scan_done)
+                return BR_ERR_X509_UNEXPECTED;
+
+            uint8_t res[32];
+            br_sha256_out(&xc->sha256, res);
+            for (size_t i = 0; i < xc->pin_count; i++)
+            {
+                if (memcmp_P(res, xc->pins[i], sizeof(res)) == 0)
+                    return 0;
+            }
+            return BR_ERR_X509_NOT_TRUSTED;
+        }
+
+        static const br_x509_pkey *pin_get_pkey(const br_x509_class *const *ctx, unsigned *usages)
+        {
+            const br_x509_pin_context *xc = reinterpret_cast<const br_x509_pin_context *>(ctx);
+            if (usages != nullptr)
+                *usages = BR_KEYTYPE_KEYX | BR_KEYTYPE_SIGN;
+            return &xc->ctx.pkey;
+        }
     }
 
 };
@@ -17,23 +17,49 @@ static size_t esp_sslclient_get_reserve_len(size_t len)
     return (size_t)newlen;
 }
 
-static void *esp_sslclient_malloc(size_t len)
+// Allocator for the library heap memory: certificates, keys, trust anchors,
+// the CertStore index and cache, session caches and the connection contexts
+// and buffers. Each function gets ctx back, release() is never called with
+// nullptr and lengths are already rounded up by esp_sslclient_get_reserve_len().
+struct esp_sslclient_allocator_t
+{
+    void *(*alloc)(void *ctx, size_t len);
+    void *(*resize)(void *ctx, void *ptr, size_t len);
+    void (*release)(void *ctx, void *ptr);
+    void *ctx;
+};
+
+// The allocator set with esp_sslclient_set_allocator(), nullptr for the heap.
+inline const esp_sslclient_allocator_t *&esp_sslclient_allocator()
+{
+    static const esp_sslclient_allocator_t *allocator = nullptr;
+    return allocator;
+}
+
+// Routes the library allocations through allocator (nullptr restores the
+// heap). Memory is freed by the allocator that is set at that time, so set it
+// before anything is allocated or after everything is freed.
+static void esp_sslclient_set_allocator(const esp_sslclient_allocator_t *allocator)
+{
+    esp_sslclient_allocator() = allocator;
+}
+
+static void *esp_sslclient_heap_alloc(size_t len)
 {
     void *p = NULL;
-    size_t newLen = esp_sslclient_get_reserve_len(len);
 
 #if defined(BOARD_HAS_PSRAM) && defined(ENABLE_PSRAM)
     if (ESP.getPsramSize() > 0)
-        p = reinterpret_cast<void *>(ps_malloc(newLen));
+        p = reinterpret_cast<void *>(ps_malloc(len));
     else
-        p = reinterpret_cast<void *>(malloc(newLen));
+        p = reinterpret_cast<void *>(malloc(len));
 #else
 
 #if defined(ESP8266_USE_EXTERNAL_HEAP) && defined(ENABLE_PSRAM)
     ESP.setExternalHeap();
 #endif
 
-    p = reinterpret_cast<void *>(malloc(newLen));
+    p = reinterpret_cast<void *>(malloc(len));
 #if defined(ESP8266_USE_EXTERNAL_HEAP) && defined(ENABLE_PSRAM)
     ESP.resetHeap();
 #endif
@@ -42,31 +68,20 @@ static void *esp_sslclient_malloc(size_t len)
     return p;
 }
 
-static void esp_sslclient_free(void *ptr)
-{
-    void **p = reinterpret_cast<void **>(ptr);
-    if (*p)
-    {
-        free(*p);
-        *p = 0;
-    }
-}
-
-static void *esp_sslclient_realloc(void *ptr, size_t sz)
+static void *esp_sslclient_heap_resize(void *ptr, size_t len)
 {
-    size_t newLen = esp_sslclient_get_reserve_len(sz);
 #if defined(BOARD_HAS_PSRAM) && defined(ENABLE_PSRAM)
     if (ESP.getPsramSize() > 0)
-        ptr = reinterpret_cast<void *>(ps_realloc(ptr, newLen));
+        ptr = reinterpret_cast<void *>(ps_realloc(ptr, len));
     else
-        ptr = reinterpret_cast<void *>(realloc(ptr, newLen));
+        ptr = reinterpret_cast<void *>(realloc(ptr, len));
 #else
 
 #if defined(ESP8266_USE_EXTERNAL_HEAP) && defined(ENABLE_PSRAM)
     ESP.setExternalHeap();
 #endif
 
-    ptr = reinterpret_cast<void *>(realloc(ptr, newLen));
+    ptr = reinterpret_cast<void *>(realloc(ptr, len));
 
 #if defined(ESP8266_USE_EXTERNAL_HEAP) && defined(ENABLE_PSRAM)
     ESP.resetHeap();
@@ -76,4 +91,117 @@ static void *esp_sslclient_realloc(void *ptr, size_t sz)
     return ptr;
 }
 
+// The allocator argument overrides the one set with
+// esp_sslclient_set_allocator(), e.g. for the state of one connection.
+static void *esp_sslclient_malloc(size_t len, const esp_sslclient_allocator_t *allocator = nullptr)
+{
+    size_t newLen = esp_sslclient_get_reserve_len(len);
+    if (!allocator)
+        allocator = esp_sslclient_allocator();
+    if (allocator)
+        return allocator->alloc(allocator->ctx, newLen);
+    return esp_sslclient_heap_alloc(newLen);
+}
+
+static void esp_sslclient_free(void *ptr, const esp_sslclient_allocator_t *allocator = nullptr)
+{
+    void **p = reinterpret_cast<void **>(ptr);
+    if (*p)
+    {
+        if (!allocator)
+            allocator = esp_sslclient_allocator();
+        if (allocator)
+            allocator->release(allocator->ctx, *p);
+        else
+            free(*p);
+        *p = 0;
+    }
+}
+
+static void *esp_sslclient_realloc(void *ptr, size_t sz, const esp_sslclient_allocator_t *allocator = nullptr)
+{
+    size_t newLen = esp_sslclient_get_reserve_len(sz);
+    if (!allocator)
+        allocator = esp_sslclient_allocator();
+    if (allocator)
+        return allocator->resize(allocator->ctx, ptr, newLen);
+    return esp_sslclient_heap_resize(ptr, newLen);
+}
+
+// Memory of one connection, from BSSL_SSLClient::getMemoryStats(). The
+// state fields are the bytes held now, the peaks and record lengths cover the
+// last connection and are reset by connect().
+struct esp_sslclient_memory_stats_t
+{
+    size_t context = 0;        // SSL client context
+    size_t buffers = 0;        // I/O and record coalescing buffers
+    size_t validator = 0;      // X.509 validator context, freed after the handshake
+    size_t session = 0;        // session ticket buffer
+    size_t current = 0;        // all the above
+    size_t credentials = 0;    // trust anchors, certificates and keys set on the client
+    size_t handshake_peak = 0; // largest current until the handshake completed
+    size_t steady_peak = 0;    // largest current after the handshake
+    size_t max_record_in = 0;  // largest record received (payload length)
+    size_t max_record_out = 0; // largest record sent (payload length)
+};
+
+#if defined(SSLCLIENT_ARENA)
+
+// Arena mode: a connection reserves one block for its BearSSL contexts and
+// buffers and takes them from it in order, the block is freed as a whole.
+struct esp_sslclient_arena_stats_t
+{
+    size_t size = 0;       // current block
+    size_t used = 0;       // taken from the current block
+    size_t high_water = 0; // largest used, over all blocks
+    size_t blocks = 0;     // blocks reserved
+    size_t fallbacks = 0;  // requests that did not fit and went to the heap
+};
+
+struct esp_sslclient_arena_t
+{
+    uint8_t *base = nullptr;
+    esp_sslclient_arena_stats_t stats;
+};
+
+// Sub-allocations keep 8 bytes alignment for the BearSSL contexts.
+static size_t esp_sslclient_arena_len(size_t len) { return (len + 7) & ~(size_t)7; }
+
+static bool esp_sslclient_arena_reserve(esp_sslclient_arena_t *arena, size_t size, const esp_sslclient_allocator_t *allocator = nullptr)
+{
+    arena->base = reinterpret_cast<uint8_t *>(esp_sslclient_malloc(size, allocator));
+    arena->stats.size = arena->base ? size : 0;
+    arena->stats.used = 0;
+    if (arena->base)
+        arena->stats.blocks++;
+    return arena->base != nullptr;
+}
+
+// Returns len bytes from the arena, or nullptr when they don't fit.
+static void *esp_sslclient_arena_alloc(esp_sslclient_arena_t *arena, size_t len)
+{
+    len = esp_sslclient_arena_len(len);
+    if (!arena->base || len > arena->stats.size - arena->stats.used)
+        return nullptr;
+    void *p = arena->base + arena->stats.used;
+    arena->stats.used += len;
+    if (arena->stats.used > arena->stats.high_water)
+        arena->stats.high_water = arena->stats.used;
+    return p;
+}
+
+static bool esp_sslclient_arena_owns(const esp_sslclient_arena_t *arena, const void *ptr)
+{
+    const uint8_t *p = reinterpret_cast<const uint8_t *>(ptr);
+    return arena->base && p >= arena->base && p < arena->base + arena->stats.size;
+}
+
+static void esp_sslclient_arena_release(esp_sslclient_arena_t *arena, const esp_sslclient_allocator_t *allocator = nullptr)
+{
+    esp_sslclient_free(&arena->base, allocator);
+    arena->stats.size = 0;
+    arena->stats.used = 0;
+}
+
+#endif
 #endif
\ No newline at end of file
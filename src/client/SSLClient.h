@@ -80,9 +80,7 @@ public:
         mClear();
         mClearAuthenticationSettings();
 #if !defined(SSLCLIENT_INSECURE_ONLY)
-#if defined(ENABLE_FS)
         _certStore = nullptr; // Don't want to remove cert store on a clear, should be long lived
-#endif
         _sk = nullptr;
 #endif
 #if defined(BSSL_BUILD_PLATFORM_CORE)
@@ -210,7 +208,7 @@ public:
 
     int available() override
     {
-        if (!mIsClientInitialized(false))
+        if (!mIsClientInitialized(false) || _async_connect)
             return 0;
 
         // ssl engine receive buffer is available
@@ -258,7 +256,7 @@ public:
 
     int read(uint8_t *buf, size_t size) override
     {
-        if (!mIsClientInitialized(false))
+        if (!mIsClientInitialized(false) || _async_connect)
             return -1;
 
         // plain mode: delegate to basic client if no SSL data remains
@@ -293,7 +291,7 @@ public:
 
     size_t write(const uint8_t *buf, size_t size) override
     {
-        if (!mIsClientInitialized(false))
+        if (!mIsClientInitialized(false) || _async_connect)
             return 0;
 
         if (!mCheckSessionTimeout())
@@ -390,10 +388,163 @@ public:
             return 0;
         }
 
-        size_t dl = stream.available();
-        uint8_t buf[dl];
-        stream.readBytes(buf, dl);
-        return write(buf, dl);
+        const size_t total = stream.available();
+        size_t written = 0;
+
+        if (!_secure)
+        {
+            // No engine buffer to read into, use a small bounce buffer.
+            uint8_t buf[128];
+            size_t avail;
+            while ((avail = stream.available()) > 0)
+            {
+                size_t n = avail > sizeof(buf) ? sizeof(buf) : avail;
+                if (_stream_chunk_size > 0 && n > _stream_chunk_size)
+                    n = _stream_chunk_size;
+                n = stream.readBytes(buf, n);
+                if (n == 0 || _basic_client->write(buf, n) != n)
+                    break;
+                written += n;
+                if (_stream_progress_cb)
+                    _stream_progress_cb(written, total, _stream_progress_arg);
+            }
+            return written;
+        }
+
+        if (!mCheckSessionTimeout())
+            return 0;
+
+        _session_ts = millis();
+
+        // Read the stream straight into the sendapp buffer, one chunk at a time.
+        // Full buffers are acked by mUpdateEngine() and sent as records.
+        size_t avail;
+        while ((avail = stream.available()) > 0)
+        {
+            if (mRunUntil(BR_SSL_SENDAPP) < 0 || !(br_ssl_engine_current_state(_eng) & BR_SSL_SENDAPP))
+            {
+#if defined(ENABLE_DEBUG)
+                esp_ssl_debug_print(PSTR("Failed while waiting for the engine to enter BR_SSL_SENDAPP."), _debug_level, esp_ssl_debug_error, __func__);
+#endif
+                break;
+            }
+
+            size_t alen;
+            unsigned char *br_buf = br_ssl_engine_sendapp_buf(_eng, &alen);
+            if (!br_buf || alen <= _write_idx)
+                break;
+
+            size_t n = alen - _write_idx;
+            if (_stream_chunk_size > 0 && n > _stream_chunk_size)
+                n = _stream_chunk_size;
+            if (n > avail)
+                n = avail;
+
+            n = stream.readBytes(br_buf + _write_idx, n);
+            if (n == 0)
+                break;
+
+#if defined(ENABLE_DEBUG)
+            // super debug
+            if (_debug_level >= esp_ssl_debug_dump)
+                DEBUG_PORT.write(br_buf + _write_idx, n);
+#endif
+
+            _write_idx += n;
+            written += n;
+
+            if (_stream_progress_cb)
+                _stream_progress_cb(written, total, _stream_progress_arg);
+        }
+
+        // The stream is done, send the last partial record as well.
+        if (_write_idx > 0 && !mSendPendingWrite())
+            return 0;
+
+        return written;
+    }
+
+    // Maximum bytes read from the source Stream per step of write(Stream &),
+    // 0 (default) reads as much as the SSL output buffer can take.
+    void setStreamChunkSize(size_t size) { _stream_chunk_size = size; }
+
+    void setStreamProgressCallback(esp_ssl_stream_progress_cb cb, void *arg = nullptr)
+    {
+        _stream_progress_cb = cb;
+        _stream_progress_arg = arg;
+    }
+
+    // Zero-copy write: returns the engine's plaintext (sendapp) buffer so the
+    // data can be serialized in place, then commitWrite() sends it.
+    // No other I/O on this client is allowed between the two calls.
+    uint8_t *getWriteBuffer(size_t *len)
+    {
+        if (len)
+            *len = 0;
+
+        if (!mIsClientInitialized(false) || !_secure)
+            return nullptr;
+
+        if (!mCheckSessionTimeout())
+            return nullptr;
+
+        if (!mSoftConnected(__func__))
+            return nullptr;
+
+        // wait until bearssl is ready to take application data
+        if (mRunUntil(BR_SSL_SENDAPP) < 0 || !(br_ssl_engine_current_state(_eng) & BR_SSL_SENDAPP))
+        {
+#if defined(ENABLE_DEBUG)
+            esp_ssl_debug_print(PSTR("Failed while waiting for the engine to enter BR_SSL_SENDAPP."), _debug_level, esp_ssl_debug_error, __func__);
+#endif
+            return nullptr;
+        }
+
+        size_t alen;
+        unsigned char *br_buf = br_ssl_engine_sendapp_buf(_eng, &alen);
+        if (!br_buf || alen <= _write_idx)
+            return nullptr;
+
+        if (len)
+            *len = alen - _write_idx;
+        return br_buf + _write_idx;
+    }
+
+    // Hands n bytes written into the getWriteBuffer() buffer to the engine
+    // and sends them as a record.
+    size_t commitWrite(size_t n)
+    {
+        if (!mIsClientInitialized(false) || !_secure || !_eng || !n)
+            return 0;
+
+        if (!(br_ssl_engine_current_state(_eng) & BR_SSL_SENDAPP))
+        {
+#if defined(ENABLE_DEBUG)
+            esp_ssl_debug_print(PSTR("The engine is not ready for data, call getWriteBuffer first."), _debug_level, esp_ssl_debug_error, __func__);
+#endif
+            return 0;
+        }
+
+        size_t alen;
+        unsigned char *br_buf = br_ssl_engine_sendapp_buf(_eng, &alen);
+        if (!br_buf || alen <= _write_idx)
+            return 0;
+
+        if (n > alen - _write_idx)
+            n = alen - _write_idx;
+
+#if defined(ENABLE_DEBUG)
+        // super debug
+        if (_debug_level >= esp_ssl_debug_dump)
+            DEBUG_PORT.write(br_buf + _write_idx, n);
+#endif
+
+        _session_ts = millis();
+        _write_idx += n;
+
+        if (!mSendPendingWrite())
+            return 0;
+        return n;
     }
 
     int peek() override
@@ -483,14 +634,127 @@ public:
         return mConnectSSL(host);
     }
 
+    // Starts the connection without waiting for the TLS handshake, which is
+    // then advanced by poll() until it returns esp_ssl_poll_ready.
+    // The TCP connect of the network client itself may still block.
+    int connectAsync(IPAddress ip, uint16_t port)
+    {
+        if (!mIsClientInitialized(true))
+            return 0;
+
+        if (!_isSSLEnabled || !mIsSecurePort(port))
+            return connect(ip, port);
+
+        if (!_basic_client->connected() && !mConnectBasicClient(nullptr, ip, port))
+            return 0;
+
+        _ip = ip;
+        _port = port;
+        _connect_with_ip = true;
+
+        return mStartAsync(nullptr);
+    }
+
+    int connectAsync(const char *host, uint16_t port)
+    {
+        if (!mIsClientInitialized(true))
+            return 0;
+
+        if (!_isSSLEnabled || !mIsSecurePort(port))
+            return connect(host, port);
+
+        if (!_basic_client->connected() && !mConnectBasicClient(host, IPAddress(), port))
+            return 0;
+
+        if (host != _host)
+        {
+            strncpy(_host, host, sizeof(_host) - 1);
+            _host[sizeof(_host) - 1] = '\0';
+        }
+
+        _port = port;
+        _connect_with_ip = false;
+
+        return mStartAsync(host);
+    }
+
+    // Advances the SSL engine as far as possible without waiting (no timeout
+    // loop, no delay) and returns an esp_ssl_poll_status.
+    int poll()
+    {
+        if (!mIsClientInitialized(false))
+            return esp_ssl_poll_error;
+
+        if (!_secure && !_async_connect)
+            return _basic_client->connected() ? esp_ssl_poll_ready : esp_ssl_poll_closed;
+
+        if (!_eng)
+            return esp_ssl_poll_closed;
+
+        _non_blocking = true;
+        unsigned state = mUpdateEngine();
+        _non_blocking = false;
+
+        if (state == 0 || (state & BR_SSL_CLOSED) || getWriteError() != esp_ssl_ok)
+        {
+            if (_async_connect)
+            {
+#if defined(ENABLE_DEBUG)
+                esp_ssl_debug_print(PSTR("Failed to initlalize the SSL layer."), _debug_level, esp_ssl_debug_error, __func__);
+                if (_eng)
+                    mPrintSSLError(br_ssl_engine_last_error(_eng), esp_ssl_debug_error, __func__);
+#endif
+                if (getWriteError() == esp_ssl_ok)
+                    setWriteError(esp_ssl_connection_fail);
+                if (_basic_client->connected())
+                    _basic_client->stop();
+                mFreeSSL();
+                return esp_ssl_poll_error;
+            }
+            return (state & BR_SSL_CLOSED) && getWriteError() == esp_ssl_ok ? esp_ssl_poll_closed : esp_ssl_poll_error;
+        }
+
+        if ((state & BR_SSL_SENDREC) || _coalesce_blocked)
+            return esp_ssl_poll_want_write;
+
+        if (_async_connect)
+        {
+            if (state & BR_SSL_SENDAPP)
+            {
+                _async_connect = false;
+                return mCompleteSSL() ? esp_ssl_poll_ready : esp_ssl_poll_error;
+            }
+
+            if (millis() - _async_start_ms > _handshake_timeout)
+            {
+#if defined(ENABLE_DEBUG)
+                esp_ssl_debug_print(PSTR("SSL handshake timed out!"), _debug_level, esp_ssl_debug_error, __func__);
+#endif
+                setWriteError(esp_ssl_connection_fail);
+                _basic_client->stop();
+                mFreeSSL();
+                return esp_ssl_poll_error;
+            }
+            return esp_ssl_poll_want_read;
+        }
+
+        if (state & BR_SSL_RECVAPP)
+            _recvapp_buf = br_ssl_engine_recvapp_buf(_eng, &_recvapp_len);
+
+        return esp_ssl_poll_ready;
+    }
+
+    // True while a connectAsync() handshake is in progress.
+    bool connecting() const { return _async_connect; }
+
     void stop() override
     {
-        if (!_secure)
+        if (!_secure && !_async_connect)
             return;
 
         // Only if we've already connected, store session params and clear the connection options
-        if (_session)
-            br_ssl_engine_get_session_parameters(_eng, _session->getSession());
+        if (!_async_connect)
+            mSaveSession();
 
         // tell the SSL connection to gracefully close
         // Disabled to prevent close_notify from hanging BSSL_SSLClient
@@ -514,6 +778,10 @@ public:
             _basic_client->stop();
         }
 
+#if defined(ENABLE_DEBUG)
+        if (_handshake_done)
+            mPrintMemoryStats(__func__);
+#endif
         mFreeSSL();
     }
 
@@ -523,6 +791,13 @@ public:
 
     void setSessionTimeout(uint32_t seconds) { _tcp_session_timeout = seconds; }
 
+    // True once the session timeout has passed since the last read or write,
+    // the next one then starts a new server connection.
+    bool sessionExpired() const
+    {
+        return _tcp_session_timeout >= BSSL_SSL_CLIENT_MIN_SESSION_TIMEOUT_SEC && _session_ts > 0 && millis() - _session_ts > _tcp_session_timeout * 1000;
+    }
+
     void flush() override
     {
         if (!_secure && _basic_client)
@@ -531,6 +806,9 @@ public:
             return;
         }
 
+        // flush releases the cork
+        _corked = false;
+
         if (_write_idx > 0)
         {
             if (mRunUntil(BR_SSL_RECVAPP) < 0)
@@ -545,6 +823,33 @@ public:
 #endif
             }
         }
+
+        if (_coalesce_len > 0 && !mSendCoalesced())
+            stop();
+    }
+
+    // Gathers outgoing TLS records in a buffer of the given size and writes
+    // them to the network client at once instead of one write and flush per
+    // record. Records are sent when the buffer is full, when the client waits
+    // for the server (read, available, handshake), on flush() and on stop().
+    // 0 (default) disables it. Takes effect on the next connection.
+    void setRecordCoalescing(size_t size) { _coalesce_size = size; }
+
+    // Holds the coalesced records (see setRecordCoalescing) until uncork() or
+    // flush(), even when reading. Only the buffer getting full sends them.
+    void cork() { _corked = true; }
+
+    bool uncork()
+    {
+        _corked = false;
+        if (!_secure || _coalesce_len == 0)
+            return true;
+        if (!mSendCoalesced())
+        {
+            stop();
+            return false;
+        }
+        return true;
     }
 
     void setBufferSizes(int recv, int xmit)
@@ -606,6 +911,41 @@ public:
 
     void setSession(BearSSL_Session *session) { _session = session; };
 
+    // Sessions for any server are taken from and saved to the cache,
+    // a session set with setSession() takes precedence.
+    void setSessionCache(BearSSL_SessionCache *cache) { _session_cache = cache; }
+
+    // Session tickets (RFC 5077) are requested and used when a session or a
+    // session cache is set, so sessions also resume on servers that keep no
+    // session cache. Disable to send no SessionTicket extension. Ticket
+    // support is compiled in only when BSSL_SESSION_TICKET_MAX_LEN is defined
+    // above 0, otherwise enabling them does nothing.
+    void setSessionTickets(bool enable)
+    {
+        _session_tickets = enable;
+#if !defined(BSSL_SESSION_TICKETS) && defined(ENABLE_DEBUG)
+        if (enable)
+            esp_ssl_debug_print(PSTR("Session tickets are not compiled in, define BSSL_SESSION_TICKET_MAX_LEN."), _debug_level, esp_ssl_debug_warn, __func__);
+#endif
+    }
+
+    // Allocator for the SSL context, I/O buffers and validator of the next
+    // connections, nullptr for the one set with esp_sslclient_set_allocator().
+    // The current connection keeps the allocator it started with.
+    void setAllocator(const esp_sslclient_allocator_t *allocator) { _allocator = allocator; }
+
+    // Memory of the current or last connection: the bytes held now per part,
+    // the credentials set on the client, the peaks during and after the
+    // handshake and the largest records seen, to size setBufferSizes().
+    esp_sslclient_memory_stats_t getMemoryStats() const { return _mem_stats; }
+
+#if defined(SSLCLIENT_ARENA)
+    // Connection arena usage: the block of the current connection, the
+    // high-water mark over all connections and the requests that fell back
+    // to the heap (buffer sizes changed after the block was sized).
+    esp_sslclient_arena_stats_t getArenaStats() const { return _arena.stats; }
+#endif
+
     void setX509Time(uint32_t now) { _now = now; }
 
 #if !defined(SSLCLIENT_INSECURE_ONLY)
@@ -684,6 +1024,35 @@ public:
         _ta = ta;
     }
 
+    // Accepts the server if the SHA-256 of its certificate's public key
+    // (the DER SubjectPublicKeyInfo, as in HPKP) is one of count pins. Only
+    // the leaf certificate is decoded, the chain, dates and server name are
+    // not checked. The array must stay valid while the client is in use.
+    void setPublicKeyPins(const uint8_t (*pins)[32], size_t count)
+    {
+        mClearAuthenticationSettings();
+        _pins = pins;
+        _pin_count = pins ? count : 0;
+        _pin_cert = false;
+    }
+
+    // As setPublicKeyPins(), with the SHA-256 of the whole leaf certificate.
+    void setCertificatePins(const uint8_t (*pins)[32], size_t count)
+    {
+        setPublicKeyPins(pins, count);
+        _pin_cert = true;
+    }
+
+    // Uses a const array of trust anchors as is, e.g. one generated by
+    // extras/host/tools/ta_array, with no PEM/DER decoding and no allocation.
+    // The array must stay valid while the client is in use.
+    void setTrustAnchors(const br_x509_trust_anchor *ta, size_t count)
+    {
+        mClearAuthenticationSettings();
+        _ta_array = ta;
+        _ta_count = ta ? count : 0;
+    }
+
     void setClientRSACert(const X509List *chain, const PrivateKey *sk)
     {
         if (_esp32_chain)
@@ -780,12 +1149,11 @@ public:
         return err; // Return the full error code including alert flags
     }
 
-#if defined(ENABLE_FS)
     void setCertStore(CertStoreBase *certStore) { _certStore = certStore; }
-#endif
     bool setCiphers(const uint16_t *cipherAry, int cipherCount)
     {
-        _cipher_list = reinterpret_cast<uint16_t *>(esp_sslclient_malloc(cipherCount));
+        esp_sslclient_free(&_cipher_list);
+        _cipher_list = reinterpret_cast<uint16_t *>(esp_sslclient_malloc(cipherCount * sizeof(uint16_t)));
         if (!_cipher_list)
         {
 #if defined(ENABLE_DEBUG)
@@ -825,12 +1193,38 @@ public:
 
     const char *peekBuffer() EMBED_SSL_ENGINE_BASE_OVERRIDE { return (const char *)_recvapp_buf; }
 
-    void peekConsume(size_t consume) EMBED_SSL_ENGINE_BASE_OVERRIDE
+    void peekConsume(size_t consume) EMBED_SSL_ENGINE_BASE_OVERRIDE { consumeRead(consume); }
+
+    // Zero-copy read: runs the engine and lends the decrypted application data
+    // of the current record. The span stays valid until consumeRead() or any
+    // other I/O on this client.
+    const uint8_t *getReadBuffer(size_t *len)
     {
-        // according to BSSL_SSLClient::read:
-        br_ssl_engine_recvapp_ack(_eng, consume);
-        _recvapp_buf = nullptr;
-        _recvapp_len = 0;
+        if (len)
+            *len = 0;
+
+        if (!_secure || available() <= 0 || !_recvapp_buf)
+            return nullptr;
+
+        if (len)
+            *len = _recvapp_len;
+        return _recvapp_buf;
+    }
+
+    // Marks n bytes of the getReadBuffer() span as processed.
+    size_t consumeRead(size_t n)
+    {
+        if (!_secure || !_eng || !_recvapp_buf || !n)
+            return 0;
+
+        if (n > _recvapp_len)
+            n = _recvapp_len;
+
+        // same bookkeeping as read()
+        br_ssl_engine_recvapp_ack(_eng, n);
+        _recvapp_buf += n;
+        _recvapp_len -= n;
+        return n;
     }
 
 #if !defined(SSLCLIENT_INSECURE_ONLY)
@@ -945,6 +1339,25 @@ public:
     void clearAuthenticationSettings() { mClearAuthenticationSettings(); }
 
 private:
+    // Connection state allocations, accounted by slot
+    enum mem_slot
+    {
+        mem_context,
+        mem_in_buffer,
+        mem_out_buffer,
+        mem_coalesce,
+        mem_ticket,
+        mem_validator,
+        mem_slot_count
+    };
+    // Position in the TLS record headers of a byte stream
+    struct RecordScan
+    {
+        uint8_t header_len = 0;
+        size_t length = 0;
+        size_t left = 0;
+    };
+
 #if defined(ENABLE_ERROR_STRING)
     /**
      * @brief Maps the base error code from BearSSL to a human-readable string.
@@ -1477,41 +1890,98 @@ private:
         return true;
     }
 
+    int mStartAsync(const char *host)
+    {
+        if (!mStartSSL(host))
+            return 0;
+
+        _async_connect = true;
+        _async_start_ms = millis();
+
+        // Send the client hello right away.
+        _non_blocking = true;
+        unsigned state = mUpdateEngine();
+        _non_blocking = false;
+        if (state == 0)
+        {
+            _async_connect = false;
+            mFreeSSL();
+            return 0;
+        }
+        return 1;
+    }
+
     int mConnectSSL(const char *host = nullptr)
     {
+        if (!mStartSSL(host))
+            return 0;
+
+// SSL/TLS handshake
+#if defined(ENABLE_DEBUG)
+        esp_ssl_debug_print(PSTR("Wait for SSL handshake."), _debug_level, esp_ssl_debug_info, __func__);
+#endif
+
+        if (mRunUntil(BR_SSL_SENDAPP, _handshake_timeout) < 0)
+        {
+#if defined(ENABLE_DEBUG)
+            esp_ssl_debug_print(PSTR("Failed to initlalize the SSL layer."), _debug_level, esp_ssl_debug_error, __func__);
+            mPrintSSLError(br_ssl_engine_last_error(_eng), esp_ssl_debug_error, __func__);
+#endif
+            mFreeSSL();
+            return 0;
+        }
+
+        return mCompleteSSL();
+    }
+
+    // Sets up the SSL context and starts the handshake (client hello is queued).
+    int mStartSSL(const char *host)
+    {
 
 #if defined(ENABLE_DEBUG)
         esp_ssl_debug_print(PSTR("Start connection."), _debug_level, esp_ssl_debug_info, __func__);
 #endif
         mFreeSSL();
         _oom_err = false;
+        _conn_allocator = _allocator;
+        _mem_stats = esp_sslclient_memory_stats_t();
+        _mem_stats.credentials = mCredentialBytes();
+        _scan_in = RecordScan();
+        _scan_out = RecordScan();
 
 #if defined(ENABLE_DEBUG) && !defined(SSLCLIENT_INSECURE_ONLY)
         // BearSSL will reject all connections unless an authentication option is set, warn in DEBUG builds
-#if defined(ENABLE_FS)
-#define CRTSTORECOND &&!_certStore
-#else
-#define CRTSTORECOND
-#endif
-        if (!_use_insecure && !_use_fingerprint && !_use_self_signed && !_knownkey CRTSTORECOND && !_ta && !_esp32_ta)
+        if (!_use_insecure && !_use_fingerprint && !_use_self_signed && !_knownkey && !_pins && !_certStore && !_ta && !_ta_array && !_esp32_ta)
         {
             esp_ssl_debug_print(PSTR("Connection *will* fail, no authentication method is setup."), _debug_level, esp_ssl_debug_warn, __func__);
         }
 #endif
 
+#if defined(SSLCLIENT_ARENA)
+        // One block for the contexts and buffers of this connection
+        if (!esp_sslclient_arena_reserve(&_arena, mArenaSize(), _conn_allocator))
+        {
+            _oom_err = true;
+#if defined(ENABLE_DEBUG)
+            esp_ssl_debug_print(PSTR("OOM error."), _debug_level, esp_ssl_debug_error, __func__);
+#endif
+            return 0;
+        }
+#endif
+
 #if defined(STATIC_SSLCLIENT_CONTEXT)
         br_ssl_client_context *sc_ptr = &_sc;
 
 #else
-        _sc = (br_ssl_client_context *)esp_sslclient_malloc(sizeof(br_ssl_client_context));
+        _sc = (br_ssl_client_context *)mConnAlloc(sizeof(br_ssl_client_context), mem_context);
         br_ssl_client_context *sc_ptr = _sc;
 #endif
 
 #if !defined(STATIC_IN_BUFFER_SIZE)
-        _iobuf_in = reinterpret_cast<unsigned char *>(esp_sslclient_malloc(_iobuf_in_size));
+        _iobuf_in = reinterpret_cast<unsigned char *>(mConnAlloc(_iobuf_in_size, mem_in_buffer));
 #endif
 #if !defined(STATIC_OUT_BUFFER_SIZE) && !defined(SSLCLIENT_HALF_DUPLEX)
-        _iobuf_out = reinterpret_cast<unsigned char *>(esp_sslclient_malloc(_iobuf_out_size));
+        _iobuf_out = reinterpret_cast<unsigned char *>(mConnAlloc(_iobuf_out_size, mem_out_buffer));
 #endif
 
 #if (!defined(STATIC_IN_BUFFER_SIZE) || !defined(STATIC_OUT_BUFFER_SIZE) || !defined(STATIC_SSLCLIENT_CONTEXT))
@@ -1551,6 +2021,20 @@ private:
 #undef NEED_OOM_CHECK
 #endif
 
+        if (_coalesce_size > 0)
+        {
+            _coalesce_buf = reinterpret_cast<unsigned char *>(mConnAlloc(_coalesce_size, mem_coalesce));
+            if (!_coalesce_buf)
+            {
+                mFreeSSL();
+                _oom_err = true;
+#if defined(ENABLE_DEBUG)
+                esp_ssl_debug_print(PSTR("OOM error."), _debug_level, esp_ssl_debug_error, __func__);
+#endif
+                return 0;
+            }
+        }
+
         _eng = &sc_ptr->eng; // Allocation/deallocation taken care of by the _sc
 
         // If no cipher list yet set, use defaults
@@ -1619,15 +2103,44 @@ private:
         br_ssl_engine_inject_entropy(_eng, rng_seeds, sizeof rng_seeds);
 
         // Restore session from the storage spot, if present
+        bool resume = false;
         if (_session)
         {
 #if defined(ENABLE_DEBUG)
             esp_ssl_debug_print(PSTR("Set SSL session!"), _debug_level, esp_ssl_debug_info, __func__);
 #endif
             br_ssl_engine_set_session_parameters(_eng, _session->getSession());
+            resume = true;
+#if defined(BSSL_SESSION_TICKETS)
+            if (_session_tickets)
+                br_ssl_client_set_session_ticket(sc_ptr, _session->_ticket, sizeof(_session->_ticket), _session->_ticket_len);
+#endif
+        }
+        else if (_session_cache)
+        {
+            char key[sizeof(_host)];
+            br_ssl_session_parameters params;
+            size_t ticket_len = 0;
+#if defined(BSSL_SESSION_TICKETS)
+            // The server may issue a ticket even if there is none yet.
+            if (_session_tickets && !_ticket_buf)
+                _ticket_buf = reinterpret_cast<uint8_t *>(mConnAlloc(BSSL_SESSION_TICKET_MAX_LEN, mem_ticket));
+#endif
+            if (_session_cache->lookup(mSessionHost(key, sizeof(key)), _port, &params, _ticket_buf, &ticket_len))
+            {
+#if defined(ENABLE_DEBUG)
+                esp_ssl_debug_print(PSTR("Set SSL session from cache!"), _debug_level, esp_ssl_debug_info, __func__);
+#endif
+                br_ssl_engine_set_session_parameters(_eng, &params);
+                resume = true;
+            }
+#if defined(BSSL_SESSION_TICKETS)
+            if (_ticket_buf)
+                br_ssl_client_set_session_ticket(sc_ptr, _ticket_buf, BSSL_SESSION_TICKET_MAX_LEN, ticket_len);
+#endif
         }
 
-        if (!br_ssl_client_reset(sc_ptr, host, _session ? 1 : 0))
+        if (!br_ssl_client_reset(sc_ptr, host, resume ? 1 : 0))
         {
 #if defined(ENABLE_DEBUG)
             esp_ssl_debug_print(PSTR("Can't reset client."), _debug_level, esp_ssl_debug_error, __func__);
@@ -1638,21 +2151,53 @@ private:
             return 0;
         }
 
-// SSL/TLS handshake
-#if defined(ENABLE_DEBUG)
-        esp_ssl_debug_print(PSTR("Wait for SSL handshake."), _debug_level, esp_ssl_debug_info, __func__);
+        return 1;
+    }
+
+    // Server name the session cache entry is keyed by.
+    const char *mSessionHost(char *buf, size_t len)
+    {
+        if (!_connect_with_ip)
+            return _host;
+        snprintf(buf, len, "%u.%u.%u.%u", _ip[0], _ip[1], _ip[2], _ip[3]);
+        return buf;
+    }
+
+    void mSaveSession()
+    {
+        const uint8_t *ticket = nullptr;
+        size_t ticket_len = 0;
+#if defined(BSSL_SESSION_TICKETS)
+        // _eng is the first member of the client context
+        br_ssl_client_context *sc_ptr = reinterpret_cast<br_ssl_client_context *>(_eng);
+        ticket = sc_ptr->session_ticket;
+        ticket_len = br_ssl_client_get_session_ticket_len(sc_ptr);
 #endif
 
-        if (mRunUntil(BR_SSL_SENDAPP, _handshake_timeout) < 0)
+        if (_session)
         {
-#if defined(ENABLE_DEBUG)
-            esp_ssl_debug_print(PSTR("Failed to initlalize the SSL layer."), _debug_level, esp_ssl_debug_error, __func__);
-            mPrintSSLError(br_ssl_engine_last_error(_eng), esp_ssl_debug_error, __func__);
+            br_ssl_engine_get_session_parameters(_eng, _session->getSession());
+#if defined(BSSL_SESSION_TICKETS)
+            if (ticket == _session->_ticket)
+            {
+                _session->_ticket_len = ticket_len;
+                _session->_ticket_lifetime = br_ssl_client_get_session_ticket_lifetime(sc_ptr);
+            }
 #endif
-            mFreeSSL();
-            return 0;
         }
 
+        if (_session_cache)
+        {
+            char key[sizeof(_host)];
+            br_ssl_session_parameters params;
+            br_ssl_engine_get_session_parameters(_eng, &params);
+            _session_cache->store(mSessionHost(key, sizeof(key)), _port, &params, ticket, ticket_len);
+        }
+    }
+
+    // Marks the connection established once the handshake is done.
+    int mCompleteSSL()
+    {
 #if defined(ENABLE_DEBUG)
         esp_ssl_debug_print(PSTR("Connection successful!"), _debug_level, esp_ssl_debug_info, __func__);
 #endif
@@ -1662,22 +2207,28 @@ private:
         _session_ts = millis();
 
         // Save session
-        if (_session)
-            br_ssl_engine_get_session_parameters(_eng, _session->getSession());
+        mSaveSession();
 
 // Session is already validated here, there is no need to keep following
 #if !defined(STATIC_X509_CONTEXT)
 
 #if !defined(SSLCLIENT_INSECURE_ONLY)
         if (_x509_minimal)
-            esp_sslclient_free((uint8_t **)&_x509_minimal);
+            mConnFree(&_x509_minimal, mem_validator);
         if (_x509_knownkey)
-            esp_sslclient_free((uint8_t **)&_x509_knownkey);
+            mConnFree(&_x509_knownkey, mem_validator);
+
+        if (_x509_pin)
+            mConnFree(&_x509_pin, mem_validator);
 #endif
 
         if (_x509_insecure)
-            esp_sslclient_free((uint8_t **)&_x509_insecure);
+            mConnFree(&_x509_insecure, mem_validator);
 
+#endif
+        mUpdateMemoryStats();
+#if defined(ENABLE_DEBUG)
+        mPrintMemoryStats(__func__);
 #endif
 
         return 1;
@@ -1746,7 +2297,7 @@ private:
         const char *func_name = __func__;
 #endif
 
-        if (_tcp_session_timeout >= BSSL_SSL_CLIENT_MIN_SESSION_TIMEOUT_SEC && _session_ts > 0 && millis() - _session_ts > _tcp_session_timeout * 1000)
+        if (sessionExpired())
         {
             if (_basic_client && _basic_client->connected())
             {
@@ -1793,7 +2344,8 @@ private:
         const unsigned long start = millis();
         for (;;)
         {
-            unsigned state = mUpdateEngine();
+            // the write path keeps coalesced records for the next ones
+            unsigned state = mUpdateEngine((target & BR_SSL_SENDAPP) != 0);
             // error check
             if (state == BR_SSL_CLOSED || getWriteError() != esp_ssl_ok)
             {
@@ -1878,6 +2430,15 @@ private:
                 }
             }
 
+#if defined __has_include
+#if __has_include(<Ethernet.h>)
+            // Waiting for the server: add a delay since spamming _basic_client->availible breaks the poor wiz chip.
+            // This is only done in this blocking loop, available() and poll() return immediately.
+            if ((state & BR_SSL_RECVREC) && !(state & BR_SSL_SENDREC))
+                delay(10);
+#endif
+#endif
+
             if (target & BR_SSL_SENDAPP)
             {
                 // reset the write index
@@ -1897,8 +2458,68 @@ private:
         }
     }
 
-    unsigned mUpdateEngine()
+    // Acks the data written at _write_idx and sends it out as a record.
+    bool mSendPendingWrite()
+    {
+        // mUpdateEngine acks the pending data, then the record is flushed out
+        if (_write_idx > 0 && !mUpdateEngine())
+            return false;
+
+        br_ssl_engine_flush(_eng, 0);
+        if (mRunUntil(BR_SSL_SENDAPP) < 0)
+        {
+#if defined(ENABLE_DEBUG)
+            esp_ssl_debug_print(PSTR("Failed while waiting for the engine to enter BR_SSL_SENDAPP."), _debug_level, esp_ssl_debug_error, __func__);
+#endif
+            return false;
+        }
+        return true;
+    }
+
+    // Writes the coalesced records to the network client with a single write and flush.
+    // In poll() mode a busy network client keeps the unsent tail for the next poll()
+    // and sets _coalesce_blocked.
+    bool mSendCoalesced()
+    {
+        size_t sent = 0;
+        _coalesce_blocked = false;
+        while (sent < _coalesce_len)
+        {
+            int wlen = _basic_client->write(_coalesce_buf + sent, _coalesce_len - sent);
+            if (wlen <= 0 && _non_blocking && _basic_client->connected() && !_basic_client->getWriteError())
+            {
+                if (sent > 0)
+                {
+                    _basic_client->flush();
+                    memmove(_coalesce_buf, _coalesce_buf + sent, _coalesce_len - sent);
+                    _coalesce_len -= sent;
+                }
+                _coalesce_blocked = true;
+                return true;
+            }
+            if (wlen <= 0)
+            {
+#if defined(ENABLE_DEBUG)
+                esp_ssl_debug_print(PSTR("Error writing to basic client."), _debug_level, esp_ssl_debug_error, __func__);
+#endif
+                _coalesce_len = 0;
+                setWriteError(esp_ssl_write_error);
+                return false;
+            }
+            sent += wlen;
+        }
+        _basic_client->flush();
+        _coalesce_len = 0;
+        return true;
+    }
+
+    unsigned mUpdateEngine(bool writing = false)
     {
+        // Coalesced records are sent before waiting for the server unless the
+        // caller is still writing or corked. The handshake never waits on them.
+        const bool hold = _handshake_done && (writing || _corked);
+        bool app_flushed = false;
+
         for (;;)
         {
             // get the state
@@ -1924,8 +2545,31 @@ private:
                 int wlen;
 
                 buf = br_ssl_engine_sendrec_buf(_eng, &len);
+
+                if (_coalesce_buf)
+                {
+                    size_t n = _coalesce_size - _coalesce_len;
+                    if (n > len)
+                        n = len;
+                    memcpy(_coalesce_buf + _coalesce_len, buf, n);
+                    _coalesce_len += n;
+                    mScanRecords(_scan_out, buf, n, _mem_stats.max_record_out);
+                    br_ssl_engine_sendrec_ack(_eng, n);
+                    if (_coalesce_len == _coalesce_size && !mSendCoalesced())
+                    {
+                        stop();
+                        return 0;
+                    }
+                    if (_coalesce_blocked)
+                        return state;
+                    continue;
+                }
+
                 wlen = _basic_client->write(buf, len);
                 _basic_client->flush();
+                // the network client is busy, let the poll() caller retry
+                if (wlen <= 0 && _non_blocking && _basic_client->connected() && !_basic_client->getWriteError())
+                    return state;
                 if (wlen <= 0)
                 {
                     // if the arduino client encountered an error
@@ -1942,6 +2586,7 @@ private:
                 }
                 if (wlen > 0)
                 {
+                    mScanRecords(_scan_out, buf, wlen, _mem_stats.max_record_out);
                     br_ssl_engine_sendrec_ack(_eng, wlen);
                 }
                 continue;
@@ -2031,6 +2676,7 @@ private:
                     }
                     if (rlen > 0)
                     {
+                        mScanRecords(_scan_in, buf, rlen, _mem_stats.max_record_in);
                         br_ssl_engine_recvrec_ack(_eng, rlen);
                     }
                     continue;
@@ -2038,18 +2684,36 @@ private:
                 // guess not, tell the state we're waiting still
                 else
                 {
+                    // Close a partially filled application record first so it
+                    // leaves in the same batch.
+                    if (_coalesce_buf && !hold && _handshake_done && !app_flushed && (state & BR_SSL_SENDAPP))
+                    {
+                        app_flushed = true;
+                        br_ssl_engine_flush(_eng, 0);
+                        continue;
+                    }
 
-#if defined __has_include
-#if __has_include(<Ethernet.h>)
-                    // Add a delay since spamming _basic_client->availible breaks the poor wiz chip
-                    delay(10);
-#endif
-#endif
+                    if (_coalesce_len > 0 && !hold)
+                    {
+                        if (!mSendCoalesced())
+                        {
+                            stop();
+                            return 0;
+                        }
+                        if (_coalesce_blocked)
+                            return state;
+                        continue;
+                    }
                     return state;
                 }
             }
             // if it's not any of the above states, then it must be waiting to send or recieve app data
             // in which case we return
+            if (_coalesce_len > 0 && !hold && !mSendCoalesced())
+            {
+                stop();
+                return 0;
+            }
             return state;
         }
     }
@@ -2133,7 +2797,7 @@ private:
     void mBSSLX509InsecureInit(bssl::br_x509_insecure_context *ctx, int _use_fingerprint, const uint8_t _fingerprint[20], int _allow_self_signed)
     {
         static const br_x509_class br_x509_insecure_vtable CONST_IN_FLASH = {
-            sizeof(bssl::br_x509_insecure_context),
+            sizeof(bssl::br_x509_insecure_storage),
             bssl::insecure_start_chain,
             bssl::insecure_start_cert,
             bssl::insecure_append,
@@ -2146,7 +2810,28 @@ private:
         ctx->done_cert = false;
         ctx->match_fingerprint = _use_fingerprint ? _fingerprint : nullptr;
         ctx->allow_self_signed = _allow_self_signed ? 1 : 0;
+        bssl::insecure_context_layout(ctx, ctx->match_fingerprint != nullptr, ctx->allow_self_signed);
+    }
+
+#if !defined(SSLCLIENT_INSECURE_ONLY)
+    void mBSSLX509PinInit(bssl::br_x509_pin_context *ctx)
+    {
+        static const br_x509_class br_x509_pin_vtable CONST_IN_FLASH = {
+            sizeof(bssl::br_x509_pin_context),
+            bssl::pin_start_chain,
+            bssl::insecure_start_cert,
+            bssl::pin_append,
+            bssl::pin_end_cert,
+            bssl::pin_end_chain,
+            bssl::pin_get_pkey};
+
+        memset(ctx, 0, sizeof *ctx);
+        ctx->vtable = &br_x509_pin_vtable;
+        ctx->pins = _pins;
+        ctx->pin_count = _pin_count;
+        ctx->match_cert = _pin_cert;
     }
+#endif
 
     void mClearAuthenticationSettings()
     {
@@ -2156,7 +2841,11 @@ private:
 
 #if !defined(SSLCLIENT_INSECURE_ONLY)
         _knownkey = nullptr;
+        _pins = nullptr;
+        _pin_count = 0;
         _ta = nullptr;
+        _ta_array = nullptr;
+        _ta_count = 0;
 
         if (_esp32_ta)
         {
@@ -2185,7 +2874,7 @@ private:
         _timeout_ms = 15000;
 #if !defined(STATIC_SSLCLIENT_CONTEXT)
         if (_sc)
-            esp_sslclient_free((br_ssl_client_context **)&_sc);
+            mConnFree(&_sc, mem_context);
 #endif
         _eng = nullptr; // Alias pointer, clear only
 
@@ -2194,31 +2883,49 @@ private:
 
 #if !defined(SSLCLIENT_INSECURE_ONLY)
         if (_x509_minimal)
-            esp_sslclient_free((uint8_t **)&_x509_minimal);
+            mConnFree(&_x509_minimal, mem_validator);
 
         if (_x509_knownkey)
-            esp_sslclient_free((uint8_t **)&_x509_knownkey);
+            mConnFree(&_x509_knownkey, mem_validator);
+
+        if (_x509_pin)
+            mConnFree(&_x509_pin, mem_validator);
 #endif
 
         if (_x509_insecure)
-            esp_sslclient_free((uint8_t **)&_x509_insecure);
+            mConnFree(&_x509_insecure, mem_validator);
 
 #endif
 
 #if !defined(STATIC_IN_BUFFER_SIZE)
         // Check and free dynamically allocated input buffer
         if (_iobuf_in)
-            esp_sslclient_free((unsigned char **)&_iobuf_in);
+            mConnFree(&_iobuf_in, mem_in_buffer);
 #endif
 #if !defined(STATIC_OUT_BUFFER_SIZE) && !defined(SSLCLIENT_HALF_DUPLEX)
         // Check and free dynamically allocated output buffer
         if (_iobuf_out)
-            esp_sslclient_free((unsigned char **)&_iobuf_out);
+            mConnFree(&_iobuf_out, mem_out_buffer);
+#endif
+
+        if (_coalesce_buf)
+            mConnFree(&_coalesce_buf, mem_coalesce);
+        _coalesce_len = 0;
+        _coalesce_blocked = false;
+        _corked = false;
+
+        if (_ticket_buf)
+            mConnFree(&_ticket_buf, mem_ticket);
+
+#if defined(SSLCLIENT_ARENA)
+        esp_sslclient_arena_release(&_arena, _conn_allocator);
 #endif
 
         _now = 0;
 #if !defined(SSLCLIENT_INSECURE_ONLY)
         _ta = nullptr;
+        _ta_array = nullptr;
+        _ta_count = 0;
 #endif
         setBufferSizes(16384, 512);
         _secure = false;
@@ -2226,6 +2933,8 @@ private:
         _recvapp_len = 0;
         _oom_err = false;
         _session = nullptr;
+        _session_cache = nullptr;
+        _session_tickets = true;
         _tls_min = BR_TLS10;
         _tls_max = BR_TLS12;
     }
@@ -2236,7 +2945,8 @@ private:
         {
 #if !defined(STATIC_X509_CONTEXT)
             // Use common insecure x509 authenticator
-            _x509_insecure = (bssl::br_x509_insecure_context *)esp_sslclient_malloc(sizeof(bssl::br_x509_insecure_context));
+            // Sized for the hashes of the policy only
+            _x509_insecure = (bssl::br_x509_insecure_context *)mConnAlloc(bssl::insecure_context_layout(nullptr, _use_fingerprint, _use_self_signed), mem_validator);
             if (!_x509_insecure)
             {
 #if defined(ENABLE_DEBUG)
@@ -2253,11 +2963,11 @@ private:
 #else // STATIC_X509_CONTEXT
       // Use common insecure x509 authenticator
 #if !defined(SSLCLIENT_INSECURE_ONLY)
-            mBSSLX509InsecureInit(&_x509_insecure, _use_fingerprint, _fingerprint, _use_self_signed);
+            mBSSLX509InsecureInit(&_x509_insecure.xc, _use_fingerprint, _fingerprint, _use_self_signed);
 #else
-            mBSSLX509InsecureInit(&_x509_insecure, _use_fingerprint, nullptr, _use_self_signed);
+            mBSSLX509InsecureInit(&_x509_insecure.xc, _use_fingerprint, nullptr, _use_self_signed);
 #endif
-            br_ssl_engine_set_x509(_eng, &_x509_insecure.vtable);
+            br_ssl_engine_set_x509(_eng, &_x509_insecure.xc.vtable);
 #endif // STATIC_X509_CONTEXT
         }
 #if !defined(SSLCLIENT_INSECURE_ONLY)
@@ -2266,7 +2976,7 @@ private:
 
 #if !defined(STATIC_X509_CONTEXT)
             // Simple, pre-known public key authenticator, ignores cert completely.
-            _x509_knownkey = (br_x509_knownkey_context *)esp_sslclient_malloc(sizeof(br_x509_knownkey_context));
+            _x509_knownkey = (br_x509_knownkey_context *)mConnAlloc(sizeof(br_x509_knownkey_context), mem_validator);
             if (!_x509_knownkey)
             {
 #if defined(ENABLE_DEBUG)
@@ -2311,13 +3021,32 @@ private:
             }
             br_ssl_engine_set_x509(_eng, &_x509_knownkey.vtable);
 
+#endif // STATIC_X509_CONTEXT
+        }
+        else if (_pins)
+        {
+#if !defined(STATIC_X509_CONTEXT)
+            // Leaf key or certificate pins, ignores the rest of the chain.
+            _x509_pin = (bssl::br_x509_pin_context *)mConnAlloc(sizeof(bssl::br_x509_pin_context), mem_validator);
+            if (!_x509_pin)
+            {
+#if defined(ENABLE_DEBUG)
+                esp_ssl_debug_print(PSTR("OOM for _x509_pin"), _debug_level, esp_ssl_debug_error, __func__);
+#endif
+                return false;
+            }
+            mBSSLX509PinInit(_x509_pin);
+            br_ssl_engine_set_x509(_eng, &_x509_pin->vtable);
+#else // STATIC_X509_CONTEXT
+            mBSSLX509PinInit(&_x509_pin);
+            br_ssl_engine_set_x509(_eng, &_x509_pin.vtable);
 #endif // STATIC_X509_CONTEXT
         }
         else
         {
 #if !defined(STATIC_X509_CONTEXT)
             // X509 minimal validator.  Checks dates, cert chain for trusted CA, etc.
-            _x509_minimal = (br_x509_minimal_context *)esp_sslclient_malloc(sizeof(br_x509_minimal_context));
+            _x509_minimal = (br_x509_minimal_context *)mConnAlloc(sizeof(br_x509_minimal_context), mem_validator);
 
             if (!_x509_minimal)
             {
@@ -2330,6 +3059,10 @@ private:
             {
                 br_x509_minimal_init(_x509_minimal, &br_sha256_vtable, _esp32_ta->getTrustAnchors(), _esp32_ta->getCount());
             }
+            else if (_ta_array)
+            {
+                br_x509_minimal_init(_x509_minimal, &br_sha256_vtable, _ta_array, _ta_count);
+            }
             else
             {
                 br_x509_minimal_init(_x509_minimal, &br_sha256_vtable, _ta ? _ta->getTrustAnchors() : nullptr, _ta ? _ta->getCount() : 0);
@@ -2349,12 +3082,10 @@ private:
                 // Magic constants convert to x509 times
                 br_x509_minimal_set_time(_x509_minimal, ((uint32_t)_now) / 86400 + 719528, ((uint32_t)_now) % 86400);
             }
-#if defined(ENABLE_FS)
             if (_certStore)
             {
                 _certStore->installCertStore(_x509_minimal);
             }
-#endif
             br_ssl_engine_set_x509(_eng, &_x509_minimal->vtable);
 
 #else // STATIC_X509_CONTEXT
@@ -2364,6 +3095,10 @@ private:
             {
                 br_x509_minimal_init(&_x509_minimal, &br_sha256_vtable, _esp32_ta->getTrustAnchors(), _esp32_ta->getCount());
             }
+            else if (_ta_array)
+            {
+                br_x509_minimal_init(&_x509_minimal, &br_sha256_vtable, _ta_array, _ta_count);
+            }
             else
             {
                 br_x509_minimal_init(&_x509_minimal, &br_sha256_vtable, _ta ? _ta->getTrustAnchors() : nullptr, _ta ? _ta->getCount() : 0);
@@ -2383,12 +3118,10 @@ private:
                 // Magic constants convert to x509 times
                 br_x509_minimal_set_time(&_x509_minimal, ((uint32_t)_now) / 86400 + 719528, ((uint32_t)_now) % 86400);
             }
-#if defined(ENABLE_FS)
             if (_certStore)
             {
                 _certStore->installCertStore(_x509_minimal.get());
             }
-#endif
             br_ssl_engine_set_x509(_eng, &_x509_minimal.vtable);
 #endif // STATIC_X509_CONTEXT
         }
@@ -2396,11 +3129,161 @@ private:
         return true;
     }
 
+    // Allocates connection state, from the connection arena in arena mode
+    // (SSLCLIENT_ARENA) and from the connection allocator when it does not fit.
+    // The bytes are accounted to slot.
+    void *mConnAlloc(size_t len, mem_slot slot)
+    {
+        void *p = nullptr;
+#if defined(SSLCLIENT_ARENA)
+        p = esp_sslclient_arena_alloc(&_arena, len);
+        if (!p)
+            _arena.stats.fallbacks++;
+#endif
+        if (!p)
+            p = esp_sslclient_malloc(len, _conn_allocator);
+        if (p)
+        {
+            _mem_bytes[slot] = len;
+            mUpdateMemoryStats();
+        }
+        return p;
+    }
+
+    // Frees connection state from mConnAlloc(), what is in the arena is only
+    // forgotten and goes with the arena.
+    void mConnFree(void *ptr, mem_slot slot)
+    {
+        _mem_bytes[slot] = 0;
+        mUpdateMemoryStats();
+#if defined(SSLCLIENT_ARENA)
+        void **p = reinterpret_cast<void **>(ptr);
+        if (esp_sslclient_arena_owns(&_arena, *p))
+        {
+            *p = nullptr;
+            return;
+        }
+#endif
+        esp_sslclient_free(ptr, _conn_allocator);
+    }
+
+    // Updates the connection state bytes and the peak of the current phase.
+    void mUpdateMemoryStats()
+    {
+        _mem_stats.context = _mem_bytes[mem_context];
+        _mem_stats.buffers = _mem_bytes[mem_in_buffer] + _mem_bytes[mem_out_buffer] + _mem_bytes[mem_coalesce];
+        _mem_stats.validator = _mem_bytes[mem_validator];
+        _mem_stats.session = _mem_bytes[mem_ticket];
+        _mem_stats.current = _mem_stats.context + _mem_stats.buffers + _mem_stats.validator + _mem_stats.session;
+        size_t &peak = _handshake_done ? _mem_stats.steady_peak : _mem_stats.handshake_peak;
+        if (_mem_stats.current > peak)
+            peak = _mem_stats.current;
+    }
+
+    // Heap bytes of the trust anchors, certificates and keys set on the client.
+    size_t mCredentialBytes() const
+    {
+        size_t bytes = 0;
+#if !defined(SSLCLIENT_INSECURE_ONLY)
+        const X509List *lists[] = {_ta, _chain, _esp32_ta, _esp32_chain};
+        for (size_t i = 0; i < sizeof(lists) / sizeof(lists[0]); i++)
+        {
+            if (lists[i])
+                bytes += lists[i]->getMemoryUsage();
+        }
+        if (_sk)
+            bytes += _sk->getMemoryUsage();
+        if (_esp32_sk)
+            bytes += _esp32_sk->getMemoryUsage();
+        if (_knownkey)
+            bytes += _knownkey->getMemoryUsage();
+#endif
+        return bytes;
+    }
+
+    // Follows the TLS record headers in the bytes sent or received, from the
+    // start of the connection, for the largest record length.
+    static void mScanRecords(RecordScan &scan, const unsigned char *buf, size_t len, size_t &max_len)
+    {
+        while (len > 0)
+        {
+            if (scan.left > 0)
+            {
+                size_t n = len < scan.left ? len : scan.left;
+                scan.left -= n;
+                buf += n;
+                len -= n;
+                continue;
+            }
+            // header: type, version, 16 bits length
+            if (scan.header_len >= 3)
+                scan.length = (scan.length << 8) | *buf;
+            buf++;
+            len--;
+            if (++scan.header_len == 5)
+            {
+                scan.left = scan.length;
+                if (scan.length > max_len)
+                    max_len = scan.length;
+                scan.header_len = 0;
+                scan.length = 0;
+            }
+        }
+    }
+
+#if defined(ENABLE_DEBUG)
+    void mPrintMemoryStats(const char *func_name)
+    {
+        char s_buffer[160];
+        snprintf_P(s_buffer, sizeof(s_buffer), PSTR("Memory: context %u, buffers %u, validator %u, session %u, credentials %u, handshake peak %u, steady peak %u, max record in %u, out %u"),
+                   (unsigned int)_mem_stats.context, (unsigned int)_mem_stats.buffers, (unsigned int)_mem_stats.validator, (unsigned int)_mem_stats.session,
+                   (unsigned int)_mem_stats.credentials, (unsigned int)_mem_stats.handshake_peak, (unsigned int)_mem_stats.steady_peak,
+                   (unsigned int)_mem_stats.max_record_in, (unsigned int)_mem_stats.max_record_out);
+        esp_ssl_debug_print(s_buffer, _debug_level, esp_ssl_debug_info, func_name);
+    }
+#endif
+
+#if defined(SSLCLIENT_ARENA)
+    // Arena size for the current buffer sizes and authentication settings.
+    size_t mArenaSize()
+    {
+        size_t len = 0;
+#if !defined(STATIC_SSLCLIENT_CONTEXT)
+        len += esp_sslclient_arena_len(sizeof(br_ssl_client_context));
+#endif
+#if !defined(STATIC_IN_BUFFER_SIZE)
+        len += esp_sslclient_arena_len(_iobuf_in_size);
+#endif
+#if !defined(STATIC_OUT_BUFFER_SIZE) && !defined(SSLCLIENT_HALF_DUPLEX)
+        len += esp_sslclient_arena_len(_iobuf_out_size);
+#endif
+        if (_coalesce_size > 0)
+            len += esp_sslclient_arena_len(_coalesce_size);
+#if defined(BSSL_SESSION_TICKETS)
+        if (_session_cache && _session_tickets)
+            len += esp_sslclient_arena_len(BSSL_SESSION_TICKET_MAX_LEN);
+#endif
+#if !defined(STATIC_X509_CONTEXT)
+        if (_use_insecure || _use_fingerprint || _use_self_signed)
+            len += esp_sslclient_arena_len(bssl::insecure_context_layout(nullptr, _use_fingerprint, _use_self_signed));
+#if !defined(SSLCLIENT_INSECURE_ONLY)
+        else if (_knownkey)
+            len += esp_sslclient_arena_len(sizeof(br_x509_knownkey_context));
+        else if (_pins)
+            len += esp_sslclient_arena_len(sizeof(bssl::br_x509_pin_context));
+        else
+            len += esp_sslclient_arena_len(sizeof(br_x509_minimal_context));
+#endif
+#endif
+        return len;
+    }
+#endif
+
     void mFreeSSL()
     {
 #if !defined(STATIC_SSLCLIENT_CONTEXT)
         if (_sc)
-            esp_sslclient_free((br_ssl_client_context **)&_sc);
+            mConnFree(&_sc, mem_context);
 #endif
         // _eng is an alias, so it is handled by the overall memory sweep.
 
@@ -2410,26 +3293,42 @@ private:
 
 #if !defined(SSLCLIENT_INSECURE_ONLY)
         if (_x509_minimal)
-            esp_sslclient_free((uint8_t **)&_x509_minimal);
+            mConnFree(&_x509_minimal, mem_validator);
 
         if (_x509_knownkey)
-            esp_sslclient_free((uint8_t **)&_x509_knownkey);
+            mConnFree(&_x509_knownkey, mem_validator);
+
+        if (_x509_pin)
+            mConnFree(&_x509_pin, mem_validator);
 #endif
 
         if (_x509_insecure)
-            esp_sslclient_free((uint8_t **)&_x509_insecure);
+            mConnFree(&_x509_insecure, mem_validator);
 
 #endif
 
 #if !defined(STATIC_IN_BUFFER_SIZE)
         // Check and free dynamically allocated input buffer
         if (_iobuf_in)
-            esp_sslclient_free((unsigned char **)&_iobuf_in);
+            mConnFree(&_iobuf_in, mem_in_buffer);
 #endif
 #if !defined(STATIC_OUT_BUFFER_SIZE) && !defined(SSLCLIENT_HALF_DUPLEX)
         // Check and free dynamically allocated output buffer
         if (_iobuf_out)
-            esp_sslclient_free((unsigned char **)&_iobuf_out);
+            mConnFree(&_iobuf_out, mem_out_buffer);
+#endif
+
+        if (_coalesce_buf)
+            mConnFree(&_coalesce_buf, mem_coalesce);
+        _coalesce_len = 0;
+        _coalesce_blocked = false;
+        _corked = false;
+
+        if (_ticket_buf)
+            mConnFree(&_ticket_buf, mem_ticket);
+
+#if defined(SSLCLIENT_ARENA)
+        esp_sslclient_arena_release(&_arena, _conn_allocator);
 #endif
 
         // Reset non-allocated ptrs (pointing to bits potentially free'd above)
@@ -2438,6 +3337,7 @@ private:
 
         // This connection is toast
         _handshake_done = false;
+        _async_connect = false;
         _timeout_ms = 15000;
         _secure = false;
         _is_connected = false;
@@ -2471,6 +3371,23 @@ private:
     //  weird timing issues
     size_t _write_idx = 0;
 
+    // write(Stream &) settings
+    size_t _stream_chunk_size = 0;
+    esp_ssl_stream_progress_cb _stream_progress_cb = nullptr;
+    void *_stream_progress_arg = nullptr;
+
+    // connectAsync()/poll() state
+    bool _async_connect = false;
+    bool _non_blocking = false;
+    unsigned long _async_start_ms = 0;
+
+    // Outgoing record coalescing (setRecordCoalescing), allocated on connect
+    size_t _coalesce_size = 0;
+    unsigned char *_coalesce_buf = nullptr;
+    size_t _coalesce_len = 0;
+    bool _coalesce_blocked = false;
+    bool _corked = false;
+
     // store the last BearSSL state so we can print changes to the console
     unsigned int _bssl_last_state = 0;
 
@@ -2489,7 +3406,7 @@ private:
 #if defined(SSLCLIENT_INSECURE_ONLY)
 
 #if defined(STATIC_X509_CONTEXT)
-    bssl::br_x509_insecure_context _x509_insecure;
+    bssl::br_x509_insecure_storage _x509_insecure;
 #else
     bssl::br_x509_insecure_context *_x509_insecure = nullptr;
 #endif
@@ -2498,12 +3415,14 @@ private:
 
 #if defined(STATIC_X509_CONTEXT)
     br_x509_minimal_context _x509_minimal;
-    bssl::br_x509_insecure_context _x509_insecure;
+    bssl::br_x509_insecure_storage _x509_insecure;
     br_x509_knownkey_context _x509_knownkey;
+    bssl::br_x509_pin_context _x509_pin;
 #else
     br_x509_minimal_context *_x509_minimal = nullptr;
     bssl::br_x509_insecure_context *_x509_insecure = nullptr;
     br_x509_knownkey_context *_x509_knownkey = nullptr;
+    bssl::br_x509_pin_context *_x509_pin = nullptr;
 #endif
 
 #endif
@@ -2538,12 +3457,12 @@ private:
 
     uint32_t _now = 0;
 
-#if defined(ENABLE_FS)
     CertStoreBase *_certStore = 0;
-#endif
 
 #if !defined(SSLCLIENT_INSECURE_ONLY)
     const X509List *_ta = nullptr;
+    const br_x509_trust_anchor *_ta_array = nullptr;
+    size_t _ta_count = 0;
     // Optional client certificate
     const X509List *_chain = nullptr;
     const PrivateKey *_sk = nullptr;
@@ -2554,6 +3473,21 @@ private:
     // Optional storage space pointer for session parameters
     // Will be used on connect and updated on close
     BearSSL_Session *_session = nullptr;
+    BearSSL_SessionCache *_session_cache = nullptr;
+    // Session ticket of the cached session in use
+    uint8_t *_ticket_buf = nullptr;
+#if defined(SSLCLIENT_ARENA)
+    esp_sslclient_arena_t _arena;
+#endif
+    // Connection state bytes per allocation and the accounting of the last connection
+    size_t _mem_bytes[mem_slot_count] = {};
+    esp_sslclient_memory_stats_t _mem_stats;
+    // Record header position in the bytes received and sent
+    RecordScan _scan_in, _scan_out;
+    // Allocator for the connection state, and the one the current connection took it from
+    const esp_sslclient_allocator_t *_allocator = nullptr;
+    const esp_sslclient_allocator_t *_conn_allocator = nullptr;
+    bool _session_tickets = true;
 
     bool _use_insecure = false;
     bool _use_fingerprint = false;
@@ -2562,6 +3496,10 @@ private:
 #if !defined(SSLCLIENT_INSECURE_ONLY)
     uint8_t _fingerprint[20];
     const PublicKey *_knownkey;
+    // Leaf SPKI or certificate SHA-256 pins
+    const uint8_t (*_pins)[32] = nullptr;
+    size_t _pin_count = 0;
+    bool _pin_cert = false;
 #endif
     unsigned int _knownkey_usages = 0;
 
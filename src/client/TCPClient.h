@@ -119,6 +119,54 @@ public:
         return _ssl_client.connect(host, port);
     }
 
+    /**
+     * @brief Starts connecting to the server without waiting for the SSL/TLS handshake.
+     * @param ip The server IP address to connect.
+     * @param port The server port.
+     * @return 1 if the handshake was started (or a plain connection was made), 0 for error.
+     * @note The handshake is then advanced by poll(). The TCP connect of the network client may still block.
+     */
+    int connectAsync(IPAddress ip, uint16_t port)
+    {
+#if defined(SSLCLIENT_INSECURE_ONLY)
+        setInsecure();
+#endif
+        _port = port;
+        return _ssl_client.connectAsync(ip, port);
+    }
+
+    /**
+     * @brief Starts connecting to the server without waiting for the SSL/TLS handshake.
+     * @param host The server host name.
+     * @param port The server port.
+     * @return 1 if the handshake was started (or a plain connection was made), 0 for error.
+     * @note The handshake is then advanced by poll(). The TCP connect of the network client may still block.
+     */
+    int connectAsync(const char *host, uint16_t port)
+    {
+#if defined(SSLCLIENT_INSECURE_ONLY)
+        setInsecure();
+#endif
+        strcpy(_host, host);
+        _port = port;
+        return _ssl_client.connectAsync(host, port);
+    }
+
+    /**
+     * @brief Advances the SSL engine without blocking (no timeout wait or delay).
+     * @return esp_ssl_poll_status: esp_ssl_poll_ready, esp_ssl_poll_want_read, esp_ssl_poll_want_write,
+     * esp_ssl_poll_closed or esp_ssl_poll_error.
+     * @note Call it from loop() after connectAsync() until it returns esp_ssl_poll_ready, and then
+     * to service the connection instead of the blocking calls.
+     */
+    int poll() { return _ssl_client.poll(); }
+
+    /**
+     * @brief Checks if a connectAsync() handshake is still in progress.
+     * @return bool True while connecting.
+     */
+    bool connecting() const { return _ssl_client.connecting(); }
+
     /**
      * @brief Gets the status of the underlying network and SSL/TLS connection.
      * @return 1 (true) if the connection is active and ready for I/O, 0 (false) otherwise.
@@ -292,6 +340,34 @@ public:
      */
     size_t write(Stream &stream) { return _ssl_client.write(stream); }
 
+    /**
+     * @brief Sets the maximum number of bytes read from the source stream per step of write(Stream &).
+     * @param size The chunk size in bytes, 0 (default) to fill the SSL output buffer on each step.
+     */
+    void setStreamChunkSize(size_t size) { _ssl_client.setStreamChunkSize(size); }
+
+    /**
+     * @brief Sets the function called after each chunk written by write(Stream &).
+     * @param cb The callback receiving the bytes written so far, the stream size at start and the user argument.
+     * @param arg The user argument passed to the callback.
+     */
+    void setStreamProgressCallback(esp_ssl_stream_progress_cb cb, void *arg = nullptr) { _ssl_client.setStreamProgressCallback(cb, arg); }
+
+    /**
+     * @brief Gets the internal SSL plaintext buffer so data can be written in place (zero-copy).
+     * @param len Receives the number of bytes that can be written into the buffer.
+     * @return The pointer to the buffer, or nullptr in plain TCP mode or on error.
+     * @note Commit the written bytes with commitWrite() before any other I/O on this client.
+     */
+    uint8_t *getWriteBuffer(size_t *len) { return _ssl_client.getWriteBuffer(len); }
+
+    /**
+     * @brief Encrypts and sends the data written into the buffer from getWriteBuffer().
+     * @param n The number of bytes written into the buffer.
+     * @return The number of bytes committed, or 0 for error.
+     */
+    size_t commitWrite(size_t n) { return _ssl_client.commitWrite(n); }
+
     /**
      * @brief Reads the next available byte without consuming it.
      * @return The byte of data read (0-255) or -1 if no data is available.
@@ -388,6 +464,12 @@ public:
         _ssl_client.setSessionTimeout(seconds);
     }
 
+    /**
+     * @brief Checks whether the TCP session timeout has passed since the last read or write.
+     * @return true if the next read or write will start a new server connection.
+     */
+    bool sessionExpired() const { return _ssl_client.sessionExpired(); }
+
     /**
      * @brief Reads all remaining data from the buffer until empty.
      */
@@ -400,6 +482,26 @@ public:
             read();
     }
 
+    /**
+     * @brief Enables coalescing of outgoing TLS records into one network write.
+     * @param size The coalescing buffer size in bytes (e.g. 1460 or a multiple of it), 0 to disable.
+     * @note Records are sent when the buffer is full, before waiting for server data, on flush() and on stop().
+     * The setting takes effect on the next connection.
+     */
+    void setRecordCoalescing(size_t size) { _ssl_client.setRecordCoalescing(size); }
+
+    /**
+     * @brief Holds the coalesced records until uncork() or flush() is called (or the coalescing buffer is full).
+     * @note Requires setRecordCoalescing(). Do not wait for a server reply while corked.
+     */
+    void cork() { _ssl_client.cork(); }
+
+    /**
+     * @brief Releases the cork and sends the coalesced records.
+     * @return True on success.
+     */
+    bool uncork() { return _ssl_client.uncork(); }
+
     /**
      * @brief Sets the requested buffer size for transmit and receive buffers in bytes.
      * @param recv The desired receive (RX) buffer size. Must be at least 512 bytes.
@@ -433,6 +535,50 @@ public:
      */
     void setSession(BearSSL_Session *session) { _ssl_client.setSession(session); };
 
+    /**
+     * @brief Sets a multi-server session cache used to resume TLS sessions automatically.
+     * @param cache Pointer to the BearSSL_SessionCache, or nullptr to disable.
+     * @note The session is looked up by the host name (or IP address) and port before the handshake,
+     * and saved after the handshake and on stop(). A session set with setSession() takes precedence.
+     */
+    void setSessionCache(BearSSL_SessionCache *cache) { _ssl_client.setSessionCache(cache); }
+
+    /**
+     * @brief Enables or disables TLS session tickets (RFC 5077).
+     * @param enable Whether to request and use session tickets.
+     * @note Ticket support is compiled in only when BSSL_SESSION_TICKET_MAX_LEN is defined above 0
+     * (it defaults to 0), otherwise this does nothing and logs a warning when enabling. With support
+     * compiled in, tickets are enabled by default and used when a session or a session cache is set.
+     * They let sessions resume on servers that keep no session cache.
+     */
+    void setSessionTickets(bool enable) { _ssl_client.setSessionTickets(enable); }
+
+    /**
+     * @brief Sets the allocator for the SSL context, I/O buffers and X.509 validator of the next connections.
+     * @param allocator The allocator, or nullptr for the one set with esp_sslclient_set_allocator().
+     * @note The allocator must outlive the connections. The current connection keeps the allocator it started with.
+     */
+    void setAllocator(const esp_sslclient_allocator_t *allocator) { _ssl_client.setAllocator(allocator); }
+
+    /**
+     * @brief Gets the memory of the current or last connection.
+     * @return The bytes held now for the SSL context, buffers, validator and session ticket,
+     * the trust anchors, certificates and keys set on the client, the peaks during and after
+     * the handshake and the largest records received and sent.
+     * @note The peaks and record lengths are reset by connect(). They are also printed at the
+     * info debug level after the handshake and on stop().
+     */
+    esp_sslclient_memory_stats_t getMemoryStats() const { return _ssl_client.getMemoryStats(); }
+
+#if defined(SSLCLIENT_ARENA)
+    /**
+     * @brief Gets the connection arena usage (SSLCLIENT_ARENA).
+     * @return The current block size and use, the high-water mark over all connections,
+     * the blocks reserved and the allocations that fell back to the heap.
+     */
+    esp_sslclient_arena_stats_t getArenaStats() const { return _ssl_client.getArenaStats(); }
+#endif
+
 #if !defined(SSLCLIENT_INSECURE_ONLY)
     /**
      * @brief Sets a known public key for verification, bypassing certificate chain validation.
@@ -466,6 +612,28 @@ public:
      */
     void setTrustAnchors(const X509List *ta) { _ssl_client.setTrustAnchors(ta); }
 
+    /**
+     * @brief Sets a const array of trusted certificate authorities (TAs), used as is.
+     * @param ta Pointer to the trust anchor array (e.g. generated by ta_array), kept valid while in use.
+     * @param count Number of trust anchors in the array.
+     */
+    void setTrustAnchors(const br_x509_trust_anchor *ta, size_t count) { _ssl_client.setTrustAnchors(ta, count); }
+
+    /**
+     * @brief Accepts the server if the SHA-256 of its certificate's public key (SubjectPublicKeyInfo) matches a pin.
+     * Only the leaf certificate is decoded; the chain, dates and server name are not checked.
+     * @param pins Array of 32-byte SHA-256 pins, kept valid while in use.
+     * @param count Number of pins in the array.
+     */
+    void setPublicKeyPins(const uint8_t (*pins)[32], size_t count) { _ssl_client.setPublicKeyPins(pins, count); }
+
+    /**
+     * @brief Accepts the server if the SHA-256 of its whole certificate matches a pin.
+     * @param pins Array of 32-byte SHA-256 pins, kept valid while in use.
+     * @param count Number of pins in the array.
+     */
+    void setCertificatePins(const uint8_t (*pins)[32], size_t count) { _ssl_client.setCertificatePins(pins, count); }
+
     /**
      * @brief Sets the client certificate and private key for mutual authentication (RSA).
      * @param cert Pointer to the X509 certificate chain.
@@ -482,13 +650,11 @@ public:
      */
     void setClientECCert(const X509List *cert, const PrivateKey *sk, unsigned allowed_usages, unsigned cert_issuer_key_type) { _ssl_client.setClientECCert(cert, sk, allowed_usages, cert_issuer_key_type); }
 
-#if defined(ENABLE_FS)
     /**
-     * @brief Sets the certificate store base for loading trust anchors from the filesystem.
+     * @brief Sets the certificate store for loading trust anchors on demand (filesystem CertStore or BSSL_TrustAnchorBundle).
      * @param certStore Pointer to the CertStoreBase implementation.
      */
     void setCertStore(CertStoreBase *certStore) { _ssl_client.setCertStore(certStore); }
-#endif
     /**
      * @brief Sets the list of preferred TLS cipher suites.
      * @param cipherAry Pointer to the array of 16-bit cipher suite identifiers.
@@ -584,6 +750,21 @@ public:
      */
     void peekConsume(size_t consume) EMBED_SSL_ENGINE_BASE_OVERRIDE { return _ssl_client.peekConsume(consume); }
 
+    /**
+     * @brief Gets the decrypted application data of the current record without copying it (zero-copy).
+     * @param len Receives the number of bytes in the returned buffer.
+     * @return The pointer to the data, or nullptr in plain TCP mode or when no data is available.
+     * @note The buffer is valid until consumeRead() or any other I/O on this client.
+     */
+    const uint8_t *getReadBuffer(size_t *len) { return _ssl_client.getReadBuffer(len); }
+
+    /**
+     * @brief Marks the bytes at the start of the getReadBuffer() buffer as processed.
+     * @param n The number of bytes processed.
+     * @return The number of bytes consumed.
+     */
+    size_t consumeRead(size_t n) { return _ssl_client.consumeRead(n); }
+
 #if !defined(SSLCLIENT_INSECURE_ONLY)
     /**
      * @brief Sets the Root CA or CA certificate for chain validation.
@@ -0,0 +1,377 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Suwatchai K. <suwatchai@outlook.com>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef BSSL_TRUST_ANCHOR_BUNDLE_H
+#define BSSL_TRUST_ANCHOR_BUNDLE_H
+
+#if defined(BSSL_BUILD_PLATFORM_CORE) || defined(BSSL_BUILD_INTERNAL_CORE)
+
+#if defined(ENABLE_FS) && !defined(FILE_READ)
+#define FILE_READ "r"
+#endif
+
+// PROGMEM on ESP8266 is only readable with aligned 32-bit loads, so the key
+// of a bundle in flash is copied to RAM before BearSSL uses it.
+#if defined(ESP8266) && !defined(BSSL_TA_BUNDLE_COPY_RECORD)
+#define BSSL_TA_BUNDLE_COPY_RECORD
+#endif
+
+// Certificate store over a precompiled trust anchor bundle, the decoded form
+// of a PEM bundle made by extras/host/tools/ta_bundle (or build()).
+//
+// The bundle is used in place, from memory (a const array, which may be in
+// PROGMEM) or from a file: the anchor is found by a binary search on the
+// SHA-256 of its subject DN and its public key is used as stored, with no
+// certificate parsing and no allocation per handshake. A file, or a bundle in
+// flash where it is not directly readable (BSSL_TA_BUNDLE_COPY_RECORD), has
+// the matching record read into one buffer of the largest record size.
+//
+// Format, little endian:
+//   header  "BTA1", count (16 bits), largest record (16 bits), total length (32 bits)
+//   index   count x (SHA-256 of the subject DN, record offset (32 bits)), sorted by hash
+//   records flags, key type, curve, 0, key length 1 (16 bits), key length 2 (16 bits), key
+//           (RSA: modulus and exponent, EC: curve point)
+class BSSL_TrustAnchorBundle : public CertStoreBase
+{
+public:
+    BSSL_TrustAnchorBundle() {}
+
+    ~BSSL_TrustAnchorBundle() { end(); }
+
+    // Uses the bundle at data (in RAM or PROGMEM), which must stay valid while
+    // in use.
+    bool begin(const uint8_t *data, size_t len)
+    {
+        end();
+        _data = data;
+        bool ret = mOpenBundle(len);
+#if defined(BSSL_TA_BUNDLE_COPY_RECORD)
+        if (ret)
+        {
+            _record = reinterpret_cast<uint8_t *>(esp_sslclient_malloc(_max_record));
+            ret = _record != nullptr;
+        }
+#endif
+        if (!ret)
+        {
+            end();
+            return false;
+        }
+        return true;
+    }
+
+#if defined(ENABLE_FS)
+    // Uses the bundle file, only the index entries visited by the search and
+    // the matching record are read on lookup.
+    bool begin(FS &fs, const char *fileName)
+    {
+        end();
+        File file = fs.open(fileName, FILE_READ);
+        if (!file)
+            return false;
+
+        _fs = &fs;
+        _file_name = reinterpret_cast<char *>(esp_sslclient_malloc(strlen(fileName) + 1));
+        if (_file_name)
+            strcpy(_file_name, fileName);
+
+        _file = &file;
+        bool ret = _file_name && mOpenBundle(file.size());
+        _file = nullptr;
+        file.close();
+
+        // one record buffer for all lookups
+        if (ret)
+            _record = reinterpret_cast<uint8_t *>(esp_sslclient_malloc(_max_record));
+        if (!ret || !_record)
+        {
+            end();
+            return false;
+        }
+        return true;
+    }
+#endif
+
+    void end()
+    {
+#if defined(ENABLE_FS)
+        esp_sslclient_free(&_file_name);
+        _fs = nullptr;
+#endif
+        esp_sslclient_free(&_record);
+        _data = nullptr;
+        _count = 0;
+        _len = 0;
+        _max_record = 0;
+    }
+
+    // Number of trust anchors in the bundle.
+    size_t count() const { return _count; }
+
+    void installCertStore(br_x509_minimal_context *ctx) override
+    {
+        br_x509_minimal_set_dynamic(ctx, (void *)this, findHashedTA, freeHashedTA);
+    }
+
+    // Returns the trust anchor whose subject DN hashes (SHA-256) to dn_hash,
+    // valid until the next lookup, or nullptr.
+    const br_x509_trust_anchor *find(const uint8_t *dn_hash)
+    {
+        if (_count == 0)
+            return nullptr;
+
+#if defined(ENABLE_FS)
+        File file;
+        if (_fs)
+        {
+            file = _fs->open(_file_name, FILE_READ);
+            if (!file)
+                return nullptr;
+            _file = &file;
+        }
+#endif
+        const br_x509_trust_anchor *ta = mFind(dn_hash);
+#if defined(ENABLE_FS)
+        if (_file)
+        {
+            _file = nullptr;
+            file.close();
+        }
+#endif
+        return ta;
+    }
+
+    // Writes the bundle for the trust anchors to out and returns its length.
+    // With out set to nullptr (or len too small) only the length is returned,
+    // 0 if an anchor can't be stored.
+    static size_t build(const br_x509_trust_anchor *tas, size_t count, uint8_t *out, size_t len)
+    {
+        size_t total = header_len + count * index_len;
+        size_t max_record = 0;
+        for (size_t i = 0; i < count; i++)
+        {
+            size_t rec = mRecordLen(tas[i]);
+            if (rec == 0 || rec > 0xffff)
+                return 0;
+            total += rec;
+            if (rec > max_record)
+                max_record = rec;
+        }
+        if (count > 0xffff)
+            return 0;
+        if (!out || len < total)
+            return total;
+
+        memset(out, 0, total);
+        memcpy(out, "BTA1", 4);
+        mPut16(out + 4, count);
+        mPut16(out + 6, max_record);
+        mPut32(out + 8, total);
+
+        // index entries in input order first, then sorted in place
+        uint8_t *index = out + header_len;
+        size_t offset = header_len + count * index_len;
+        for (size_t i = 0; i < count; i++)
+        {
+            const br_x509_trust_anchor &ta = tas[i];
+            uint8_t *e = index + i * index_len;
+            br_sha256_context sha;
+            br_sha256_init(&sha);
+            br_sha256_update(&sha, ta.dn.data, ta.dn.len);
+            br_sha256_out(&sha, e);
+            mPut32(e + 32, offset);
+
+            uint8_t *r = out + offset;
+            r[0] = ta.flags;
+            r[1] = ta.pkey.key_type;
+            if (ta.pkey.key_type == BR_KEYTYPE_RSA)
+            {
+                mPut16(r + 4, ta.pkey.key.rsa.nlen);
+                mPut16(r + 6, ta.pkey.key.rsa.elen);
+                memcpy(r + 8, ta.pkey.key.rsa.n, ta.pkey.key.rsa.nlen);
+                memcpy(r + 8 + ta.pkey.key.rsa.nlen, ta.pkey.key.rsa.e, ta.pkey.key.rsa.elen);
+            }
+            else
+            {
+                r[2] = ta.pkey.key.ec.curve;
+                mPut16(r + 4, ta.pkey.key.ec.qlen);
+                memcpy(r + 8, ta.pkey.key.ec.q, ta.pkey.key.ec.qlen);
+            }
+            offset += mRecordLen(ta);
+        }
+
+        // insertion sort, bundles are built once
+        for (size_t i = 1; i < count; i++)
+        {
+            uint8_t tmp[index_len];
+            memcpy(tmp, index + i * index_len, index_len);
+            size_t j = i;
+            while (j > 0 && memcmp(index + (j - 1) * index_len, tmp, 32) > 0)
+            {
+                memcpy(index + j * index_len, index + (j - 1) * index_len, index_len);
+                j--;
+            }
+            memcpy(index + j * index_len, tmp, index_len);
+        }
+        return total;
+    }
+
+    // Disable the copy constructor, we're pointer based
+    BSSL_TrustAnchorBundle(const BSSL_TrustAnchorBundle &that) = delete;
+    BSSL_TrustAnchorBundle &operator=(const BSSL_TrustAnchorBundle &that) = delete;
+
+private:
+    static const size_t header_len = 12;
+    static const size_t index_len = 36;
+    static const size_t record_header_len = 8;
+
+    // These need to be static as they are callbacks from BearSSL C code
+    static const br_x509_trust_anchor *findHashedTA(void *ctx, void *hashed_dn, size_t len)
+    {
+        BSSL_TrustAnchorBundle *bundle = static_cast<BSSL_TrustAnchorBundle *>(ctx);
+        if (!bundle || len != 32)
+            return nullptr;
+        return bundle->find(static_cast<const uint8_t *>(hashed_dn));
+    }
+
+    static void freeHashedTA(void *ctx, const br_x509_trust_anchor *ta)
+    {
+        // The anchor lives in the bundle (or the record buffer).
+        (void)ctx;
+        (void)ta;
+    }
+
+    bool mOpenBundle(size_t len)
+    {
+        uint8_t h[header_len];
+        if (len < header_len || !mRead(0, h, header_len) || memcmp(h, "BTA1", 4) != 0)
+            return false;
+
+        _count = mGet16(h + 4);
+        _max_record = mGet16(h + 6);
+        _len = mGet32(h + 8);
+        return _len <= len && header_len + _count * index_len <= _len && _max_record >= record_header_len;
+    }
+
+    const br_x509_trust_anchor *mFind(const uint8_t *dn_hash)
+    {
+        uint8_t e[index_len];
+
+        // first entry not below dn_hash
+        size_t lo = 0, hi = _count;
+        while (lo < hi)
+        {
+            size_t mid = (lo + hi) / 2;
+            if (!mRead(header_len + mid * index_len, e, index_len))
+                return nullptr;
+            if (memcmp(e, dn_hash, 32) < 0)
+                lo = mid + 1;
+            else
+                hi = mid;
+        }
+        if (lo == _count || !mRead(header_len + lo * index_len, e, index_len) || memcmp(e, dn_hash, 32) != 0)
+            return nullptr;
+
+        const size_t offset = mGet32(e + 32);
+        const uint8_t *r = mRecord(offset, record_header_len);
+        if (!r)
+            return nullptr;
+        const uint8_t flags = r[0], key_type = r[1], curve = r[2];
+        const size_t len1 = mGet16(r + 4), len2 = mGet16(r + 6);
+        r = mRecord(offset, record_header_len + len1 + len2);
+        if (!r)
+            return nullptr;
+
+        memcpy(_dn_hash, dn_hash, sizeof(_dn_hash));
+        memset(&_ta, 0, sizeof(_ta));
+        _ta.dn.data = _dn_hash;
+        _ta.dn.len = sizeof(_dn_hash);
+        _ta.flags = flags;
+        _ta.pkey.key_type = key_type;
+        if (key_type == BR_KEYTYPE_RSA)
+        {
+            _ta.pkey.key.rsa.n = const_cast<uint8_t *>(r + record_header_len);
+            _ta.pkey.key.rsa.nlen = len1;
+            _ta.pkey.key.rsa.e = const_cast<uint8_t *>(r + record_header_len + len1);
+            _ta.pkey.key.rsa.elen = len2;
+        }
+        else if (key_type == BR_KEYTYPE_EC)
+        {
+            _ta.pkey.key.ec.curve = curve;
+            _ta.pkey.key.ec.q = const_cast<uint8_t *>(r + record_header_len);
+            _ta.pkey.key.ec.qlen = len1;
+        }
+        else
+            return nullptr;
+        return &_ta;
+    }
+
+    // Copies len bytes at offset of the bundle to buf.
+    bool mRead(size_t offset, uint8_t *buf, size_t len)
+    {
+#if defined(ENABLE_FS)
+        if (_file)
+            return _file->seek(offset, SeekSet) && (size_t)_file->read(buf, len) == len;
+#endif
+        if (!_data || (_len > 0 && offset + len > _len))
+            return false;
+        memcpy_P(buf, _data + offset, len);
+        return true;
+    }
+
+    // Returns the len bytes of the record at offset, read into the record
+    // buffer if there is one, else in place.
+    const uint8_t *mRecord(size_t offset, size_t len)
+    {
+        if (offset + len > _len)
+            return nullptr;
+        if (_record)
+            return len <= _max_record && mRead(offset, _record, len) ? _record : nullptr;
+        return _data ? _data + offset : nullptr;
+    }
+
+    static size_t mRecordLen(const br_x509_trust_anchor &ta)
+    {
+        if (ta.pkey.key_type == BR_KEYTYPE_RSA)
+            return record_header_len + ta.pkey.key.rsa.nlen + ta.pkey.key.rsa.elen;
+        if (ta.pkey.key_type == BR_KEYTYPE_EC)
+            return record_header_len + ta.pkey.key.ec.qlen;
+        return 0;
+    }
+
+    static void mPut16(uint8_t *p, uint16_t v)
+    {
+        p[0] = v & 0xff;
+        p[1] = v >> 8;
+    }
+
+    static void mPut32(uint8_t *p, uint32_t v)
+    {
+        mPut16(p, v & 0xffff);
+        mPut16(p + 2, v >> 16);
+    }
+
+    static uint16_t mGet16(const uint8_t *p) { return p[0] | (p[1] << 8); }
+
+    static uint32_t mGet32(const uint8_t *p) { return mGet16(p) | ((uint32_t)mGet16(p + 2) << 16); }
+
+    const uint8_t *_data = nullptr;
+    size_t _count = 0;
+    size_t _len = 0;
+    size_t _max_record = 0;
+#if defined(ENABLE_FS)
+    FS *_fs = nullptr;
+    char *_file_name = nullptr;
+    File *_file = nullptr;
+#endif
+    uint8_t *_record = nullptr;
+    uint8_t _dn_hash[32];
+    br_x509_trust_anchor _ta;
+};
+
+#endif
+
+#endif